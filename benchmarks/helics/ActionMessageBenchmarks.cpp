@@ -134,4 +134,131 @@ static void BMdepacketizeStrings(benchmark::State& state)
 // Register the function as a benchmark
 BENCHMARK(BMdepacketizeStrings);
 
+static void BMcopyMessage(benchmark::State& state)
+{
+    ActionMessage obj(CMD_SEND_MESSAGE);
+    obj.payload = "message data";
+    obj.setStringData("dest", "source", "orig_source", "orig_dest");
+    for (auto _ : state) {
+        ActionMessage cpy(obj);
+        benchmark::DoNotOptimize(cpy);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMcopyMessage);
+
+static void BMmoveMessage(benchmark::State& state)
+{
+    ActionMessage obj(CMD_SEND_MESSAGE);
+    obj.payload = "message data";
+    obj.setStringData("dest", "source", "orig_source", "orig_dest");
+    for (auto _ : state) {
+        ActionMessage mv(std::move(obj));
+        obj = std::move(mv);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMmoveMessage);
+
+static void BMfromStringMessage(benchmark::State& state)
+{
+    ActionMessage obj(CMD_SEND_MESSAGE);
+    obj.payload = "message data";
+    obj.setStringData("dest", "source", "orig_source", "orig_dest");
+    std::string load;
+    load.reserve(500);
+    obj.to_string(load);
+
+    for (auto _ : state) {
+        ActionMessage conv(load);
+        benchmark::DoNotOptimize(conv);
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMfromStringMessage);
+
+/** generate the test messages for the encoding comparisons*/
+static ActionMessage encodingTestMessage(int64_t type)
+{
+    switch (type) {
+        case 0:
+        default: {
+            ActionMessage obj(CMD_TIME_REQUEST);
+            obj.source_id = global_federate_id(131074);
+            obj.dest_id = global_federate_id(131075);
+            obj.actionTime = 10.0;
+            obj.Te = 10.0;
+            obj.Tdemin = 10.5;
+            return obj;
+        }
+        case 1: {
+            ActionMessage obj(CMD_PUB);
+            obj.source_id = global_federate_id(131074);
+            obj.source_handle = interface_handle(4);
+            obj.dest_id = global_federate_id(131075);
+            obj.dest_handle = interface_handle(2);
+            obj.actionTime = 5.0;
+            obj.payload = std::string(8, '\x21');
+            return obj;
+        }
+        case 2: {
+            ActionMessage obj(CMD_SEND_MESSAGE);
+            obj.source_id = global_federate_id(131074);
+            obj.source_handle = interface_handle(4);
+            obj.actionTime = 5.0;
+            obj.payload = "message data";
+            obj.setStringData("dest", "source", "orig_source", "orig_dest");
+            return obj;
+        }
+    }
+}
+
+static void EncodingArguments(benchmark::internal::Benchmark* b)
+{
+    for (int type = 0; type <= 2; ++type) {
+        b->Args({type, 0});
+        b->Args({type, 1});
+    }
+}
+
+/** encode a message in the standard or compact encoding and report the size on the wire*/
+static void BMencoding(benchmark::State& state)
+{
+    auto obj = encodingTestMessage(state.range(0));
+    bool compact = (state.range(1) != 0);
+    std::string load;
+    load.reserve(500);
+    for (auto _ : state) {
+        if (compact) {
+            obj.to_compact_string(load);
+        } else {
+            obj.to_string(load);
+        }
+        benchmark::DoNotOptimize(load);
+    }
+    state.counters["bytes"] = static_cast<double>(load.size());
+}
+// Register the function as a benchmark
+BENCHMARK(BMencoding)
+    ->Apply(EncodingArguments)
+    ->ArgNames({"type", "compact"});
+
+/** decode a message in the standard or compact encoding*/
+static void BMdecoding(benchmark::State& state)
+{
+    auto obj = encodingTestMessage(state.range(0));
+    bool compact = (state.range(1) != 0);
+    std::string load = (compact) ? obj.to_compact_string() : obj.to_string();
+    ActionMessage conv;
+    for (auto _ : state) {
+        conv.from_string(load);
+        benchmark::DoNotOptimize(conv);
+    }
+    state.counters["bytes"] = static_cast<double>(load.size());
+}
+// Register the function as a benchmark
+BENCHMARK(BMdecoding)
+    ->Apply(EncodingArguments)
+    ->ArgNames({"type", "compact"});
+
 HELICS_BENCHMARK_MAIN(actionMessageBenchmark);
@@ -0,0 +1,103 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/ActionMessageQueue.hpp"
+#include "helics_benchmark_main.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace helics; //NOLINT
+
+static constexpr int messagesPerProducer{10000};
+
+/** push messages from a set of producer threads into a queue while a single consumer drains it
+@details the push latency of each message is recorded and the percentiles reported as counters*/
+static void BMqueueContention(benchmark::State& state)
+{
+    auto producerCount = static_cast<int>(state.range(0));
+    auto queueType = static_cast<ActionMessageQueue::queue_type>(state.range(1));
+    std::vector<std::vector<std::chrono::nanoseconds::rep>> latencies(producerCount);
+    for (auto& lat : latencies) {
+        lat.reserve(messagesPerProducer);
+    }
+    std::vector<std::chrono::nanoseconds::rep> allLatencies;
+    for (auto _ : state) {
+        ActionMessageQueue queue;
+        queue.setQueueType(queueType);
+        std::atomic<int> ready{0};
+        std::atomic<bool> go{false};
+        std::vector<std::thread> producers;
+        for (int ii = 0; ii < producerCount; ++ii) {
+            latencies[ii].clear();
+            producers.emplace_back([&, ii]() {
+                ActionMessage msg(CMD_PUB);
+                msg.source_id = global_federate_id(ii);
+                msg.payload = "value data";
+                ++ready;
+                while (!go.load()) {
+                    std::this_thread::yield();
+                }
+                for (int jj = 0; jj < messagesPerProducer; ++jj) {
+                    msg.counter = static_cast<uint16_t>(jj);
+                    auto start = std::chrono::steady_clock::now();
+                    queue.push(msg);
+                    auto end = std::chrono::steady_clock::now();
+                    latencies[ii].push_back((end - start).count());
+                }
+            });
+        }
+        while (ready.load() < producerCount) {
+            std::this_thread::yield();
+        }
+        auto start = std::chrono::steady_clock::now();
+        go.store(true);
+        for (int ii = 0; ii < producerCount * messagesPerProducer; ++ii) {
+            auto msg = queue.pop();
+            benchmark::DoNotOptimize(msg);
+        }
+        auto end = std::chrono::steady_clock::now();
+        for (auto& prod : producers) {
+            prod.join();
+        }
+        state.SetIterationTime(std::chrono::duration<double>(end - start).count());
+        for (auto& lat : latencies) {
+            allLatencies.insert(allLatencies.end(), lat.begin(), lat.end());
+        }
+    }
+    std::sort(allLatencies.begin(), allLatencies.end());
+    auto percentile = [&allLatencies](double pct) {
+        auto index = static_cast<std::size_t>(pct * static_cast<double>(allLatencies.size() - 1));
+        return static_cast<double>(allLatencies[index]);
+    };
+    state.counters["p50_ns"] = percentile(0.5);
+    state.counters["p90_ns"] = percentile(0.9);
+    state.counters["p99_ns"] = percentile(0.99);
+    state.counters["p999_ns"] = percentile(0.999);
+    state.counters["max_ns"] = static_cast<double>(allLatencies.back());
+    state.SetItemsProcessed(state.iterations() * producerCount * messagesPerProducer);
+}
+
+static void QueueArguments(benchmark::internal::Benchmark* b)
+{
+    for (int type = 0; type <= 1; ++type) {
+        for (int producers = 1; producers <= 64; producers *= 2) {
+            b->Args({producers, type});
+        }
+    }
+}
+// Register the function as a benchmark
+BENCHMARK(BMqueueContention)
+    ->Apply(QueueArguments)
+    ->ArgNames({"producers", "lockfree"})
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+HELICS_BENCHMARK_MAIN(actionQueueBenchmark);
@@ -0,0 +1,66 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/application_api/HelicsPrimaryTypes.hpp"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+/** the element by element comparison used before the block comparison*/
+static bool scalarChangeDetected(const double* prev, const double* vals, size_t size, double deltaV)
+{
+    for (size_t ii = 0; ii < size; ++ii) {
+        if (std::abs(prev[ii] - vals[ii]) > deltaV) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** compare two vectors that differ by less than the tolerance so every element is checked
+@details range(0) is the number of elements in the vectors*/
+static void BMvector_change(benchmark::State& state, bool blocked)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    std::vector<double> prev(size);
+    std::vector<double> vals(size);
+    for (size_t ii = 0; ii < size; ++ii) {
+        prev[ii] = static_cast<double>(ii) * 0.5;
+        vals[ii] = prev[ii] + 0.001;
+    }
+    for (auto _ : state) {
+        bool changed = blocked ?
+            helics::vectorChangeDetected(prev.data(), vals.data(), size, 0.01) :
+            scalarChangeDetected(prev.data(), vals.data(), size, 0.01);
+        benchmark::DoNotOptimize(changed);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_CAPTURE(BMvector_change, scalar, false)->RangeMultiplier(8)->Range(8, 1 << 17);
+BENCHMARK_CAPTURE(BMvector_change, blocked, true)->RangeMultiplier(8)->Range(8, 1 << 17);
+
+/** check for a change against a previous value held in the value variant as publications do
+@details range(0) is the number of elements in the vectors*/
+static void BMvector_change_variant(benchmark::State& state)
+{
+    const auto size = static_cast<size_t>(state.range(0));
+    std::vector<double> vals(size, 1.0);
+    helics::defV prev = vals;
+    vals.back() += 0.001;
+    for (auto _ : state) {
+        bool changed = helics::changeDetected(prev, vals, 0.01);
+        benchmark::DoNotOptimize(changed);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(BMvector_change_variant)->RangeMultiplier(8)->Range(8, 1 << 17);
+
+HELICS_BENCHMARK_MAIN(changeDetectionBenchmark);
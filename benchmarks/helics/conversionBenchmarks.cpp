@@ -5,11 +5,14 @@ the top-level NOTICE for additional details. All rights reserved.
 SPDX-License-Identifier: BSD-3-Clause
 */
 
+#include "helics/application_api/HelicsPrimaryTypes.hpp"
 #include "helics/application_api/ValueConverter.hpp"
 #include "helics/application_api/ValueConverter_impl.hpp"
 #include "helics_benchmark_main.h"
 
 #include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
 
 template<class T>
 static void BMconversion(benchmark::State& state, const T& arg)
@@ -74,4 +77,194 @@ BENCHMARK_CAPTURE(
 
 BENCHMARK_CAPTURE(BMinterpret, vector_interp, std::vector<double>{26.5, 18.6, -48.5, -5.4e-12});
 
+/** compare the archive encoding of a double to the direct fixed size encoding used for publications
+of double type*/
+static void BMdouble_encode(benchmark::State& state, bool direct)
+{
+    double val{-356.56e-27};
+    helics::data_block store;
+    char buffer[helics::detail::doubleEncodingSize];
+    for (auto _ : state) {
+        if (direct) {
+            helics::detail::encodeDirect(val, buffer);
+            benchmark::DoNotOptimize(buffer);
+        } else {
+            helics::ValueConverter<double>::convert(val, store);
+            benchmark::DoNotOptimize(store);
+        }
+        val += 1.0;
+    }
+}
+
+BENCHMARK_CAPTURE(BMdouble_encode, archive, false);
+BENCHMARK_CAPTURE(BMdouble_encode, direct, true);
+
+/** compare the archive decoding of a double to the direct decoding used by inputs of double type*/
+static void BMdouble_decode(benchmark::State& state, bool direct)
+{
+    helics::data_block store;
+    helics::ValueConverter<double>::convert(-356.56e-27, store);
+    helics::data_view stv{store};
+    double val{0.0};
+    for (auto _ : state) {
+        if (direct) {
+            helics::detail::decodeDirect(stv, val);
+        } else {
+            helics::ValueConverter<double>::interpret(stv, val);
+        }
+        benchmark::DoNotOptimize(val);
+    }
+}
+
+BENCHMARK_CAPTURE(BMdouble_decode, archive, false);
+BENCHMARK_CAPTURE(BMdouble_decode, direct, true);
+
+/** compare the generic formatting of a double as a string to the shortest round trip formatting*/
+static void BMdouble_string(benchmark::State& state, bool shortest)
+{
+    double val{-356.56e-7};
+    std::string str;
+    for (auto _ : state) {
+        str = (shortest) ? helics::helicsDoubleString(val) : std::to_string(val);
+        benchmark::DoNotOptimize(str);
+        val += 1.0;
+    }
+}
+
+BENCHMARK_CAPTURE(BMdouble_string, to_string, false);
+BENCHMARK_CAPTURE(BMdouble_string, shortest, true);
+
+using helics::data_type;
+
+/** the data types covered by the conversion pair benchmarks*/
+static const std::vector<data_type> conversionTypes{data_type::helics_double,
+                                                    data_type::helics_int,
+                                                    data_type::helics_string,
+                                                    data_type::helics_complex,
+                                                    data_type::helics_vector,
+                                                    data_type::helics_complex_vector,
+                                                    data_type::helics_named_point,
+                                                    data_type::helics_bool,
+                                                    data_type::helics_time};
+
+static const std::string sampleString{"4.79"};
+static const std::vector<double> sampleVector{26.5, 18.6, -48.5, -5.4e-12};
+static const std::vector<std::complex<double>> sampleComplexVector{{45.7, -19.5}, {-1.25, 3.4}};
+static const helics::NamedPoint samplePoint{"point", 15.7};
+
+/** convert a sample value of one type to a data block of another type as a publication would*/
+static helics::data_block encodeSample(data_type sourceType, data_type targetType)
+{
+    switch (sourceType) {
+        case data_type::helics_double:
+        default:
+            return helics::typeConvert(targetType, -356.56e-7);
+        case data_type::helics_int:
+            return helics::typeConvert(targetType, int64_t{-12351341});
+        case data_type::helics_string:
+            return helics::typeConvert(targetType, sampleString);
+        case data_type::helics_complex:
+            return helics::typeConvert(targetType, std::complex<double>{45.7, -19.5});
+        case data_type::helics_vector:
+            return helics::typeConvert(targetType, sampleVector);
+        case data_type::helics_complex_vector:
+            return helics::typeConvert(targetType, sampleComplexVector);
+        case data_type::helics_named_point:
+            return helics::typeConvert(targetType, samplePoint);
+        case data_type::helics_bool:
+            return helics::typeConvert(targetType, true);
+        case data_type::helics_time:
+            return helics::typeConvert(targetType, helics::Time(3.5).getBaseTimeCode());
+    }
+}
+
+template<class X>
+static void extractSample(const helics::data_view& dv, data_type sourceType)
+{
+    X val;
+    helics::valueExtract(dv, sourceType, val);
+    benchmark::DoNotOptimize(val);
+}
+
+/** extract a data block of one type to the value type of another as an input would*/
+static void decodeSample(const helics::data_view& dv, data_type sourceType, data_type targetType)
+{
+    switch (targetType) {
+        case data_type::helics_double:
+        default:
+            extractSample<double>(dv, sourceType);
+            break;
+        case data_type::helics_int:
+            extractSample<int64_t>(dv, sourceType);
+            break;
+        case data_type::helics_string:
+            extractSample<std::string>(dv, sourceType);
+            break;
+        case data_type::helics_complex:
+            extractSample<std::complex<double>>(dv, sourceType);
+            break;
+        case data_type::helics_vector:
+            extractSample<std::vector<double>>(dv, sourceType);
+            break;
+        case data_type::helics_complex_vector:
+            extractSample<std::vector<std::complex<double>>>(dv, sourceType);
+            break;
+        case data_type::helics_named_point:
+            extractSample<helics::NamedPoint>(dv, sourceType);
+            break;
+        case data_type::helics_bool:
+            extractSample<bool>(dv, sourceType);
+            break;
+        case data_type::helics_time:
+            extractSample<helics::Time>(dv, sourceType);
+            break;
+    }
+}
+
+static void setPairLabel(benchmark::State& state)
+{
+    state.SetLabel(
+        helics::typeNameStringRef(conversionTypes[state.range(0)]) + "->" +
+        helics::typeNameStringRef(conversionTypes[state.range(1)]));
+}
+
+/** convert a value of the type in range(0) to a data block of the type in range(1)*/
+static void BMtype_encode(benchmark::State& state)
+{
+    auto sourceType = conversionTypes[state.range(0)];
+    auto targetType = conversionTypes[state.range(1)];
+    for (auto _ : state) {
+        auto db = encodeSample(sourceType, targetType);
+        benchmark::DoNotOptimize(db);
+    }
+    setPairLabel(state);
+}
+
+/** extract a data block of the type in range(0) to a value of the type in range(1)*/
+static void BMtype_decode(benchmark::State& state)
+{
+    auto sourceType = conversionTypes[state.range(0)];
+    auto targetType = conversionTypes[state.range(1)];
+    auto db = encodeSample(sourceType, sourceType);
+    helics::data_view dv{db};
+    for (auto _ : state) {
+        decodeSample(dv, sourceType, targetType);
+    }
+    setPairLabel(state);
+}
+
+/** generate the arguments for every pair of conversion types*/
+static void conversionPairs(benchmark::internal::Benchmark* bench)
+{
+    auto count = static_cast<int64_t>(conversionTypes.size());
+    for (int64_t ii = 0; ii < count; ++ii) {
+        for (int64_t jj = 0; jj < count; ++jj) {
+            bench->Args({ii, jj});
+        }
+    }
+}
+
+BENCHMARK(BMtype_encode)->Apply(conversionPairs);
+BENCHMARK(BMtype_decode)->Apply(conversionPairs);
+
 HELICS_BENCHMARK_MAIN(conversionBenchmark);
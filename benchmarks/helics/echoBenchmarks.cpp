@@ -17,9 +17,12 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <fstream>
 #include <gmlc/concurrency/Barrier.hpp>
 #include <iostream>
+#include <string>
 #include <thread>
 
-static void BMecho_singleCore(benchmark::State& state)
+/** run the echo federates on a single inproc core
+@param coreArgs additional arguments for the core*/
+static void echoSingleCore(benchmark::State& state, const std::string& coreArgs)
 {
     for (auto _ : state) {
         state.PauseTiming();
@@ -27,7 +30,8 @@ static void BMecho_singleCore(benchmark::State& state)
         int feds = static_cast<int>(state.range(0));
         gmlc::concurrency::Barrier brr(static_cast<size_t>(feds) + 1);
         auto wcore = helics::CoreFactory::create(
-            core_type::INPROC, std::string("--autobroker --federates=") + std::to_string(feds + 1));
+            core_type::INPROC,
+            std::string("--autobroker --federates=") + std::to_string(feds + 1) + coreArgs);
         EchoHub hub;
         hub.initialize(wcore->getIdentifier(), "--num_leafs=" + std::to_string(feds));
         std::vector<EchoLeaf> leafs(feds);
@@ -54,6 +58,11 @@ static void BMecho_singleCore(benchmark::State& state)
         state.ResumeTiming();
     }
 }
+
+static void BMecho_singleCore(benchmark::State& state)
+{
+    echoSingleCore(state, std::string());
+}
 // Register the function as a benchmark
 BENCHMARK(BMecho_singleCore)
     ->RangeMultiplier(2)
@@ -62,6 +71,36 @@ BENCHMARK(BMecho_singleCore)
     ->Iterations(1)
     ->UseRealTime();
 
+/** the echo federates on a single core with the federates split across a number of shards
+@details only the value delivery between local federates moves to the shards,  compared with
+BMecho_singleCore this shows what taking the values off the main loop gains, shards1 is the cost
+of the extra hop with no parallelism*/
+static void BMecho_singleCoreSharded(benchmark::State& state, int shards)
+{
+    echoSingleCore(state, " --shards=" + std::to_string(shards));
+}
+
+BENCHMARK_CAPTURE(BMecho_singleCoreSharded, shards1, 1)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 8)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMecho_singleCoreSharded, shards4, 4)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 8)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMecho_singleCoreSharded, shards16, 16)
+    ->RangeMultiplier(2)
+    ->Range(1, 1 << 8)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->Iterations(1)
+    ->UseRealTime();
+
 static void BMecho_multiCore(benchmark::State& state, core_type cType)
 {
     for (auto _ : state) {
@@ -148,6 +187,17 @@ BENCHMARK_CAPTURE(BMecho_multiCore, ipcCore, core_type::IPC)
 
 #endif
 
+#ifdef ENABLE_SHM_CORE
+// Register the shared memory benchmarks
+BENCHMARK_CAPTURE(BMecho_multiCore, shmCore, core_type::SHM)
+    ->RangeMultiplier(2)
+    ->Range(1, maxscale)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+#endif
+
 #ifdef ENABLE_TCP_CORE
 // Register the TCP benchmarks
 BENCHMARK_CAPTURE(BMecho_multiCore, tcpCore, core_type::TCP)
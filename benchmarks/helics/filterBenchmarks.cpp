@@ -7,7 +7,10 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "EchoMessageHubFederate.hpp"
 #include "EchoMessageLeafFederate.hpp"
+#include "helics/application_api/FilterOperations.hpp"
 #include "helics/application_api/Filters.hpp"
+#include "helics/application_api/MessageOperators.hpp"
+#include "helics/core/ActionMessage.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
 #include "helics/helics-config.h"
@@ -201,4 +204,36 @@ BENCHMARK_CAPTURE(BMfilter_multiCore, udpCore, core_type::UDP)
     ->UseRealTime();
 #endif
 
+/** measure a delay and a reroute operator on a message as done in a core
+@details the capture selects whether the operators modify the message in place or go through a
+Message object as operators with user supplied Message functions do*/
+static void BMfilter_operator(benchmark::State& state, bool inPlace)
+{
+    helics::DelayFilterOperation delay(0.5);
+    helics::RerouteFilterOperation reroute;
+    reroute.setString("newdestination", "rerouted_endpoint");
+    auto delayOp = delay.getOperator();
+    auto rerouteOp = reroute.getOperator();
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.setStringData("destination_endpoint", "source_endpoint", "source_endpoint", "");
+    cmd.payload.assign(static_cast<std::size_t>(state.range(0)), 'a');
+    for (auto _ : state) {
+        cmd.actionTime = helics::timeZero;
+        if (inPlace) {
+            auto view = createMessageView(cmd);
+            delayOp->processInPlace(view);
+            rerouteOp->processInPlace(view);
+        } else {
+            auto message = delayOp->process(createMessageFromCommand(std::move(cmd)));
+            message = rerouteOp->process(std::move(message));
+            cmd.moveInfo(std::move(message));
+        }
+        benchmark::DoNotOptimize(cmd);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_CAPTURE(BMfilter_operator, inPlace, true)->RangeMultiplier(16)->Range(8, 1 << 14);
+BENCHMARK_CAPTURE(BMfilter_operator, message, false)->RangeMultiplier(16)->Range(8, 1 << 14);
+
 HELICS_BENCHMARK_MAIN(filterBenchmark);
@@ -0,0 +1,127 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/ValueFederates.hpp"
+#include "helics/core/BrokerFactory.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/helics-config.h"
+#include "helics_benchmark_main.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+static constexpr int grantSteps{20000};
+
+/** step a federate through time recording the wall clock latency of each time request*/
+static std::vector<std::chrono::nanoseconds::rep> stepFederate(helics::ValueFederate& fed)
+{
+    std::vector<std::chrono::nanoseconds::rep> latencies;
+    latencies.reserve(grantSteps);
+    fed.enterExecutingMode();
+    for (int ii = 1; ii <= grantSteps; ++ii) {
+        auto start = std::chrono::steady_clock::now();
+        fed.requestTime(static_cast<helics::Time>(ii));
+        auto end = std::chrono::steady_clock::now();
+        latencies.push_back((end - start).count());
+    }
+    fed.finalize();
+    return latencies;
+}
+
+/** measure the latency of time grants between two federates stepping in lock step
+@details the percentiles of the request latency of both federates and a histogram of the latency
+in power of 4 bins are reported as counters*/
+static void BMgrant_latency(benchmark::State& state, core_type cType, bool busyPoll)
+{
+    std::vector<std::chrono::nanoseconds::rep> allLatencies;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto broker = helics::BrokerFactory::create(cType, "brokerg", "--federates=2");
+        broker->setLoggingLevel(helics_log_level_no_print);
+        auto core = helics::CoreFactory::create(cType, "--federates=2 --log_level=no_print");
+        helics::FederateInfo fi(cType);
+        fi.coreName = core->getIdentifier();
+        fi.setFlagOption(helics_flag_busy_poll, busyPoll);
+        helics::ValueFederate fed1("fedA", fi);
+        helics::ValueFederate fed2("fedB", fi);
+        // link the federates both ways so each grant depends on the other federate
+        fed1.registerGlobalPublication<double>("pubA");
+        fed2.registerSubscription("pubA");
+        fed2.registerGlobalPublication<double>("pubB");
+        fed1.registerSubscription("pubB");
+        state.ResumeTiming();
+
+        auto res = std::async(std::launch::async, [&fed2]() { return stepFederate(fed2); });
+        auto lat1 = stepFederate(fed1);
+        auto lat2 = res.get();
+
+        state.PauseTiming();
+        allLatencies.insert(allLatencies.end(), lat1.begin(), lat1.end());
+        allLatencies.insert(allLatencies.end(), lat2.begin(), lat2.end());
+        broker->waitForDisconnect();
+        broker.reset();
+        core.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    std::sort(allLatencies.begin(), allLatencies.end());
+    auto percentile = [&allLatencies](double pct) {
+        auto index = static_cast<std::size_t>(pct * static_cast<double>(allLatencies.size() - 1));
+        return static_cast<double>(allLatencies[index]);
+    };
+    state.counters["p50_ns"] = percentile(0.5);
+    state.counters["p90_ns"] = percentile(0.9);
+    state.counters["p99_ns"] = percentile(0.99);
+    state.counters["p999_ns"] = percentile(0.999);
+    state.counters["max_ns"] = static_cast<double>(allLatencies.back());
+    // histogram of the latencies with bins of 1us,4us,16us,64us,256us,1ms and above
+    static const std::vector<std::pair<std::chrono::nanoseconds::rep, std::string>> bins{
+        {1000, "le_1us"},
+        {4000, "le_4us"},
+        {16000, "le_16us"},
+        {64000, "le_64us"},
+        {256000, "le_256us"},
+        {1024000, "le_1ms"}};
+    auto lower = allLatencies.begin();
+    for (const auto& bin : bins) {
+        auto upper = std::upper_bound(lower, allLatencies.end(), bin.first);
+        state.counters[bin.second] = static_cast<double>(upper - lower);
+        lower = upper;
+    }
+    state.counters["gt_1ms"] = static_cast<double>(allLatencies.end() - lower);
+    state.SetItemsProcessed(state.iterations() * grantSteps);
+}
+
+BENCHMARK_CAPTURE(BMgrant_latency, inprocCore, core_type::INPROC, false)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMgrant_latency, inprocCoreBusyPoll, core_type::INPROC, true)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+#ifdef ENABLE_ZMQ_CORE
+BENCHMARK_CAPTURE(BMgrant_latency, zmqCore, core_type::ZMQ, false)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMgrant_latency, zmqCoreBusyPoll, core_type::ZMQ, true)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+#endif
+
+HELICS_BENCHMARK_MAIN(grantLatencyBenchmark);
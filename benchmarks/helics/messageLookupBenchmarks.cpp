@@ -10,6 +10,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/ActionMessage.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
+#include "helics/core/EndpointInfo.hpp"
+#include "helics/core/HandleManager.hpp"
+#include "helics/core/RouteTable.hpp"
 #include "helics/helics-config.h"
 #include "helics_benchmark_main.h"
 
@@ -18,6 +21,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <fstream>
 #include <gmlc/concurrency/Barrier.hpp>
 #include <iostream>
+#include <map>
 #include <random>
 #include <thread>
 
@@ -208,6 +212,139 @@ BENCHMARK_CAPTURE(BMmgen_multiCore, inprocCore_big8, core_type::INPROC)
     ->Ranges({{1 << 17, 1 << 19}, {8, 8}})
     ->Iterations(1)
     ->UseRealTime();
+/** build a handle manager with a set of endpoints spread over a number of federates*/
+static helics::HandleManager generateEndpointHandles(int endpointCount)
+{
+    helics::HandleManager hman;
+    for (int ii = 0; ii < endpointCount; ++ii) {
+        hman.addHandle(
+            helics::global_federate_id(helics::global_federate_id_shift + ii / 10),
+            helics::handle_type::endpoint,
+            "ept_" + std::to_string(ii),
+            std::string(),
+            std::string());
+    }
+    return hman;
+}
+
+static constexpr int lookupCount{10000};
+
+static void BMlookup_endpointName(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto hman = generateEndpointHandles(count);
+    std::mt19937 eng(count);
+    std::uniform_int_distribution<> dest(0, count - 1);
+    std::vector<std::string> names(lookupCount);
+    for (auto& name : names) {
+        name = "ept_" + std::to_string(dest(eng));
+    }
+    for (auto _ : state) {
+        for (auto& name : names) {
+            benchmark::DoNotOptimize(hman.getEndpoint(name));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lookupCount);
+}
+BENCHMARK(BMlookup_endpointName)->RangeMultiplier(10)->Range(1000, 100000);
+
+static void BMlookup_endpointHandle(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    auto hman = generateEndpointHandles(count);
+    std::mt19937 eng(count);
+    std::uniform_int_distribution<> dest(0, count - 1);
+    std::vector<helics::global_handle> ids(lookupCount);
+    for (auto& id : ids) {
+        id = hman.getHandleInfo(dest(eng))->handle;
+    }
+    for (auto _ : state) {
+        for (auto& id : ids) {
+            benchmark::DoNotOptimize(hman.findHandle(id));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lookupCount);
+}
+BENCHMARK(BMlookup_endpointHandle)->RangeMultiplier(10)->Range(1000, 100000);
+
+/** compare the route lookup of an ordered map to the dense route table*/
+static void BMlookup_route(benchmark::State& state)
+{
+    auto count = static_cast<int>(state.range(0));
+    bool useTable = (state.range(1) != 0);
+    std::map<helics::global_federate_id, helics::route_id> routeMap;
+    helics::RouteTable routeTable;
+    for (int ii = 0; ii < count; ++ii) {
+        helics::global_federate_id fid(helics::global_federate_id_shift + ii);
+        routeMap.emplace(fid, helics::route_id(ii % 64 + 1));
+        routeTable.addRoute(fid, helics::route_id(ii % 64 + 1));
+    }
+    std::mt19937 eng(count);
+    std::uniform_int_distribution<> dest(0, count - 1);
+    std::vector<helics::global_federate_id> ids(lookupCount);
+    for (auto& id : ids) {
+        id = helics::global_federate_id(helics::global_federate_id_shift + dest(eng));
+    }
+    for (auto _ : state) {
+        if (useTable) {
+            for (auto& id : ids) {
+                benchmark::DoNotOptimize(routeTable.getRoute(id));
+            }
+        } else {
+            for (auto& id : ids) {
+                auto fnd = routeMap.find(id);
+                benchmark::DoNotOptimize(
+                    (fnd != routeMap.end()) ? fnd->second : helics::parent_route_id);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * lookupCount);
+}
+BENCHMARK(BMlookup_route)
+    ->RangeMultiplier(10)
+    ->Ranges({{1000, 100000}, {0, 1}})
+    ->ArgNames({"routes", "table"});
+
+/** deliver a time step of messages from many senders to a single endpoint then drain it the way a
+federate does, checking the queue size before each retrieval*/
+static void BMendpoint_singleSink(benchmark::State& state)
+{
+    auto senders = static_cast<int>(state.range(0));
+    auto count = static_cast<int>(state.range(1));
+    std::vector<std::string> sources(senders);
+    for (int ii = 0; ii < senders; ++ii) {
+        sources[ii] = "fed_" + std::to_string(ii) + "/ept";
+    }
+    std::mt19937 eng(senders);
+    std::uniform_int_distribution<> src(0, senders - 1);
+    std::vector<int> order(count);
+    for (auto& sindex : order) {
+        sindex = src(eng);
+    }
+    helics::EndpointInfo sink(
+        {helics::global_federate_id(helics::global_federate_id_shift), helics::interface_handle(1)},
+        "sink",
+        "");
+    helics::Time step{helics::timeZero};
+    for (auto _ : state) {
+        step += helics::Time(1, time_units::ms);
+        for (auto sindex : order) {
+            auto msg = std::make_unique<helics::Message>();
+            msg->time = step;
+            msg->original_source = sources[sindex];
+            sink.addMessage(std::move(msg));
+        }
+        while (sink.queueSize(step) > 0) {
+            benchmark::DoNotOptimize(sink.getMessage(step));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BMendpoint_singleSink)
+    ->RangeMultiplier(10)
+    ->Ranges({{10, 1000}, {1000, 100000}})
+    ->ArgNames({"senders", "messages"});
+
 /*
 // Register the ZMQ benchmarks
 BENCHMARK_CAPTURE (BM_ring_multiCore, zmqCore, core_type::ZMQ)
@@ -0,0 +1,107 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/ValueFederates.hpp"
+#include "helics/core/BrokerFactory.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/helics-config.h"
+#include "helics_benchmark_main.h"
+
+#include <benchmark/benchmark.h>
+#include <future>
+#include <memory>
+#include <string>
+
+/** register the interfaces of one federate and enter executing mode
+@details the federate publishes count values and subscribes to each of the publications of the
+other federate by name*/
+static void registerAndExecute(
+    helics::ValueFederate& fed,
+    const std::string& prefix,
+    const std::string& otherPrefix,
+    int count)
+{
+    for (int ii = 0; ii < count; ++ii) {
+        fed.registerGlobalPublication<double>(prefix + std::to_string(ii));
+        fed.registerSubscription(otherPrefix + std::to_string(ii));
+    }
+    fed.enterExecutingMode();
+}
+
+/** measure the time from the start of interface registration to executing mode for two federates
+on separate cores linking every interface by name
+@details range(0) is the number of publications and subscriptions in each federate,  the capture
+selects whether the registrations are packed*/
+static void BMstartup_interfaces(benchmark::State& state, core_type cType, bool packed)
+{
+    const int count = static_cast<int>(state.range(0));
+    const std::string packing =
+        packed ? std::string() : std::string(" --registration_package_size=0");
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto broker = helics::BrokerFactory::create(cType, "brokers", "--federates=2" + packing);
+        broker->setLoggingLevel(helics_log_level_no_print);
+        auto core1 =
+            helics::CoreFactory::create(cType, "--federates=1 --log_level=no_print" + packing);
+        auto core2 =
+            helics::CoreFactory::create(cType, "--federates=1 --log_level=no_print" + packing);
+        helics::ValueFederate fed1("fedA", core1);
+        helics::ValueFederate fed2("fedB", core2);
+        state.ResumeTiming();
+
+        auto res = std::async(std::launch::async, [&fed2, count]() {
+            registerAndExecute(fed2, "b_", "a_", count);
+        });
+        registerAndExecute(fed1, "a_", "b_", count);
+        res.get();
+
+        state.PauseTiming();
+        fed1.finalize();
+        fed2.finalize();
+        broker->waitForDisconnect();
+        broker.reset();
+        core1.reset();
+        core2.reset();
+        helics::cleanupHelicsLibrary();
+        state.ResumeTiming();
+    }
+    state.counters["interfaces"] = static_cast<double>(count) * 4.0;
+}
+
+static constexpr int64_t maxInterfaces{1 << 15};
+
+BENCHMARK_CAPTURE(BMstartup_interfaces, inprocCore, core_type::INPROC, true)
+    ->RangeMultiplier(4)
+    ->Range(1 << 9, maxInterfaces)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMstartup_interfaces, inprocCoreUnpacked, core_type::INPROC, false)
+    ->RangeMultiplier(4)
+    ->Range(1 << 9, maxInterfaces)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+#ifdef ENABLE_ZMQ_CORE
+BENCHMARK_CAPTURE(BMstartup_interfaces, zmqCore, core_type::ZMQ, true)
+    ->RangeMultiplier(4)
+    ->Range(1 << 9, maxInterfaces)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMstartup_interfaces, zmqCoreUnpacked, core_type::ZMQ, false)
+    ->RangeMultiplier(4)
+    ->Range(1 << 9, maxInterfaces)
+    ->Iterations(1)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+#endif
+
+HELICS_BENCHMARK_MAIN(startupBenchmark);
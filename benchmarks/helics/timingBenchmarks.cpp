@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "TimingLeafFederate.hpp"
 #include "helics/core/BrokerFactory.hpp"
 #include "helics/core/CoreFactory.hpp"
+#include "helics/core/ForwardingTimeCoordinator.hpp"
 #include "helics/helics-config.h"
 #include "helics_benchmark_main.h"
 
@@ -18,6 +19,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <gmlc/concurrency/Barrier.hpp>
 #include <iostream>
 #include <thread>
+#include <vector>
 
 static void BMtiming_singleCore(benchmark::State& state)
 {
@@ -179,4 +181,79 @@ BENCHMARK_CAPTURE(BMtiming_multiCore, udpCore, core_type::UDP)
     ->UseRealTime();
 #endif
 
+/** process a time request from every leaf dependency of a forwarding time coordinator
+@details this is the work a broker does per time step for its time coordination,  each request
+updates the dependency and recomputes the minimum times*/
+static void BMtiming_forwardingCoordinator(benchmark::State& state)
+{
+    auto leafs = static_cast<int>(state.range(0));
+    helics::ForwardingTimeCoordinator ftc;
+    std::size_t sent{0};
+    ftc.setMessageSender([&sent](const helics::ActionMessage& /*msg*/) { ++sent; });
+    ftc.source_id = helics::global_federate_id(0x7000'0001);
+    ftc.addDependent(helics::global_federate_id(0x7000'0000));
+    for (int ii = 0; ii < leafs; ++ii) {
+        ftc.addDependency(helics::global_federate_id(0x2'0000 + ii));
+    }
+    helics::ActionMessage treq(CMD_TIME_REQUEST);
+    int step{0};
+    for (auto _ : state) {
+        ++step;
+        for (int ii = 0; ii < leafs; ++ii) {
+            treq.source_id = helics::global_federate_id(0x2'0000 + ii);
+            treq.actionTime =
+                helics::Time(step, time_units::ms) + helics::Time(ii % 7, time_units::us);
+            treq.Te = treq.actionTime;
+            treq.Tdemin = treq.actionTime;
+            if (ftc.processTimeMessage(treq)) {
+                ftc.updateTimeFactors();
+            }
+        }
+    }
+    benchmark::DoNotOptimize(sent);
+    state.SetItemsProcessed(state.iterations() * leafs);
+    state.counters["updates_sent"] =
+        static_cast<double>(sent) / static_cast<double>(state.iterations());
+}
+// Register the function as a benchmark
+BENCHMARK(BMtiming_forwardingCoordinator)->Arg(10)->Arg(100)->Arg(1000)->Arg(5000);
+
+/** the same time step with the minimum times recomputed by a scan of the dependencies on every
+request,  the approach used before the dependencies tracked the minimum times*/
+static void BMtiming_dependencyScan(benchmark::State& state)
+{
+    auto leafs = static_cast<int>(state.range(0));
+    helics::TimeDependencies deps;
+    for (int ii = 0; ii < leafs; ++ii) {
+        deps.addDependency(helics::global_federate_id(0x2'0000 + ii));
+    }
+    helics::ActionMessage treq(CMD_TIME_REQUEST);
+    int step{0};
+    for (auto _ : state) {
+        ++step;
+        for (int ii = 0; ii < leafs; ++ii) {
+            treq.source_id = helics::global_federate_id(0x2'0000 + ii);
+            treq.actionTime =
+                helics::Time(step, time_units::ms) + helics::Time(ii % 7, time_units::us);
+            treq.Te = treq.actionTime;
+            treq.Tdemin = treq.actionTime;
+            deps.updateTime(treq);
+            helics::Time minNext = helics::Time::maxVal();
+            helics::Time minDe = helics::Time::maxVal();
+            helics::Time minminDe = helics::Time::maxVal();
+            for (const auto& dep : deps) {
+                minNext = std::min(minNext, dep.Tnext);
+                minDe = std::min(minDe, dep.Te);
+                minminDe = std::min(minminDe, dep.Tdemin);
+            }
+            benchmark::DoNotOptimize(minNext);
+            benchmark::DoNotOptimize(minDe);
+            benchmark::DoNotOptimize(minminDe);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * leafs);
+}
+// Register the function as a benchmark
+BENCHMARK(BMtiming_dependencyScan)->Arg(10)->Arg(100)->Arg(1000)->Arg(5000);
+
 HELICS_BENCHMARK_MAIN(timingBenchmark);
@@ -0,0 +1,92 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/core/ActionMessage.hpp"
+#include "helics/helics-config.h"
+#include "helics_benchmark_main.h"
+
+#ifdef ENABLE_UDP_CORE
+#    include "helics/network/udp/UdpComms.h"
+
+#    include <atomic>
+#    include <chrono>
+#    include <future>
+#    include <string>
+#    include <thread>
+
+/** send a stream of small value messages between two UdpComms over loopback
+@details range(0) is the number of messages per iteration, the capture selects the batched mode,
+messages lost by the receiver are reported in the dropped counter*/
+static void BMudpThroughput(benchmark::State& state, bool batching)
+{
+    const int msgCount = static_cast<int>(state.range(0));
+    std::atomic<int> received{0};
+    std::string host = "localhost";
+
+    helics::udp::UdpComms sender;
+    sender.loadTargetInfo(host, host);
+    helics::udp::UdpComms receiver;
+    receiver.loadTargetInfo(host, std::string());
+
+    sender.setBrokerPort(23921);
+    sender.setPortNumber(23925);
+    sender.setName("bm_sender");
+    receiver.setName("bm_receiver");
+    receiver.setPortNumber(23921);
+    sender.setFlag("batching", batching);
+    receiver.setFlag("batching", batching);
+
+    sender.setCallback([](const helics::ActionMessage& /*m*/) {});
+    receiver.setCallback([&received](const helics::ActionMessage& m) {
+        if (m.action() == helics::CMD_PUB) {
+            ++received;
+        }
+    });
+
+    auto connected = std::async(std::launch::async, [&sender] { return sender.connect(); });
+    if (!receiver.connect() || !connected.get()) {
+        state.SkipWithError("unable to connect udp comms");
+        return;
+    }
+
+    helics::ActionMessage pub(helics::CMD_PUB);
+    pub.payload = "3.14159265358979";
+    int64_t dropped{0};
+    for (auto _ : state) {
+        received = 0;
+        for (int ii = 0; ii < msgCount; ++ii) {
+            pub.counter = static_cast<uint16_t>(ii);
+            sender.transmit(helics::parent_route_id, pub);
+        }
+        auto stop = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (received < msgCount && std::chrono::steady_clock::now() < stop) {
+            std::this_thread::yield();
+        }
+        dropped += msgCount - received;
+    }
+    state.SetItemsProcessed(state.iterations() * msgCount);
+    state.counters["dropped"] = static_cast<double>(dropped);
+
+    sender.disconnect();
+    receiver.disconnect();
+}
+
+BENCHMARK_CAPTURE(BMudpThroughput, single, false)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_CAPTURE(BMudpThroughput, batched, true)
+    ->RangeMultiplier(10)
+    ->Range(1000, 100000)
+    ->Unit(benchmark::TimeUnit::kMillisecond)
+    ->UseRealTime();
+
+#endif
+
+HELICS_BENCHMARK_MAIN(udpCommsBenchmark);
@@ -65,6 +65,9 @@ static const std::map<std::string, int> propStringsTranslations{
     {"logLevel", helics_property_int_log_level},
     {"maxIterations", helics_property_int_max_iterations},
     {"iterations", helics_property_int_max_iterations},
+    {"busy_poll_budget", helics_property_int_busy_poll_budget},
+    {"busypollbudget", helics_property_int_busy_poll_budget},
+    {"busyPollBudget", helics_property_int_busy_poll_budget},
     {"interruptible", helics_flag_interruptible},
     {"uninterruptible", helics_flag_uninterruptible},
     {"observer", helics_flag_observer},
@@ -78,6 +81,9 @@ static const std::map<std::string, int> propStringsTranslations{
     {"slowResponding", helics_flag_slow_responding},
     {"no_ping", helics_flag_slow_responding},
     {"disable_ping", helics_flag_slow_responding},
+    {"busy_poll", helics_flag_busy_poll},
+    {"busypoll", helics_flag_busy_poll},
+    {"busyPoll", helics_flag_busy_poll},
     {"only_update_on_change", helics_flag_only_update_on_change},
     {"only_transmit_on_change", helics_flag_only_transmit_on_change},
     {"forward_compute", helics_flag_forward_compute},
@@ -116,7 +122,10 @@ static const std::set<std::string> validIntProperties{"max_iterations",
                                                       "log_level",
                                                       "logLevel",
                                                       "maxIterations",
-                                                      "maxiterations"};
+                                                      "maxiterations",
+                                                      "busy_poll_budget",
+                                                      "busypollbudget",
+                                                      "busyPollBudget"};
 
 static const std::set<std::string> validFlagOptions{"interruptible",
                                                     "uninterruptible",
@@ -143,6 +152,9 @@ static const std::set<std::string> validFlagOptions{"interruptible",
                                                     "disable_ping",
                                                     "no_ping",
                                                     "slow",
+                                                    "busy_poll",
+                                                    "busypoll",
+                                                    "busyPoll",
                                                     "required",
                                                     "optional",
                                                     "terminate_on_error",
@@ -412,6 +424,13 @@ std::unique_ptr<helicsCLI11App> FederateInfo::makeCLIApp()
            "the maximum number of iterations a federate is allowed to take")
         ->ignore_underscore()
         ->check(CLI::PositiveNumber);
+    app->add_option_function<int>(
+           "--busypollbudget",
+           [this](int val) { setProperty(helics_property_int_busy_poll_budget, val); },
+           "the number of microseconds a busy polling federate spins before sleeping (0 for no "
+           "limit)")
+        ->ignore_underscore()
+        ->check(CLI::NonNegativeNumber);
     app->add_option_function<int>(
            "--loglevel,--log-level",
            [this](int val) { setProperty(helics_property_int_log_level, val); },
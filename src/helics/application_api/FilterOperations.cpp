@@ -252,10 +252,11 @@ std::shared_ptr<FilterOperator> RandomDelayFilterOperation::getOperator()
 }
 
 RandomDropFilterOperation::RandomDropFilterOperation():
-    tcond(std::make_shared<MessageConditionalOperator>([this](const Message*) {
-        return (randDouble(random_dists_t::bernoulli, (1.0 - dropProb), 1.0) > 0.1);
-    }))
+    tcond(std::make_shared<MessageConditionalOperator>())
 {
+    tcond->setViewConditionFunction([this](const MessageView& /*mess*/) {
+        return (randDouble(random_dists_t::bernoulli, (1.0 - dropProb), 1.0) > 0.1);
+    });
 }
 
 RandomDropFilterOperation::~RandomDropFilterOperation() = default;
@@ -344,10 +345,9 @@ std::string
     return dest;
 }
 
-FirewallFilterOperation::FirewallFilterOperation():
-    op(std::make_shared<FirewallOperator>(
-        [this](const Message* mess) { return allowPassed(mess); }))
+FirewallFilterOperation::FirewallFilterOperation(): op(std::make_shared<FirewallOperator>())
 {
+    op->setViewCheckFunction([this](const MessageView& mess) { return allowPassed(mess); });
 }
 
 FirewallFilterOperation::~FirewallFilterOperation() = default;
@@ -363,14 +363,17 @@ std::shared_ptr<FilterOperator> FirewallFilterOperation::getOperator()
     return std::static_pointer_cast<FilterOperator>(op);
 }
 
-bool FirewallFilterOperation::allowPassed(const Message* /*mess*/) const
+bool FirewallFilterOperation::allowPassed(const MessageView& /*mess*/) const
 {
     return true;
 }
 
-CloneFilterOperation::CloneFilterOperation():
-    op(std::make_shared<CloneOperator>([this](const Message* mess) { return sendMessage(mess); }))
+CloneFilterOperation::CloneFilterOperation(): op(std::make_shared<CloneOperator>())
 {
+    op->setCloneDestinationFunction(
+        [this](const MessageView& /*mess*/, std::vector<std::string>& destinations) {
+            getDestinations(destinations);
+        });
 }
 
 CloneFilterOperation::~CloneFilterOperation() = default;
@@ -413,15 +416,9 @@ std::shared_ptr<FilterOperator> CloneFilterOperation::getOperator()
     return std::static_pointer_cast<FilterOperator>(op);
 }
 
-std::vector<std::unique_ptr<Message>> CloneFilterOperation::sendMessage(const Message* mess) const
+void CloneFilterOperation::getDestinations(std::vector<std::string>& destinations) const
 {
-    std::vector<std::unique_ptr<Message>> messages;
     auto lock = deliveryAddresses.lock_shared();
-    for (auto& add : *lock) {
-        messages.push_back(std::make_unique<Message>(*mess));
-        messages.back()->original_dest = messages.back()->dest;
-        messages.back()->dest = add;
-    }
-    return messages;
+    destinations.insert(destinations.end(), lock->begin(), lock->end());
 }
 } // namespace helics
@@ -25,6 +25,7 @@ class Core;
 class FilterOperator;
 class MessageTimeOperator;
 class Message;
+class MessageView;
 class MessageConditionalOperator;
 class MessageDestOperator;
 class CloneOperator;
@@ -136,7 +137,7 @@ class FirewallFilterOperation: public FilterOperations {
 
   private:
     /** function to execute the rerouting operation*/
-    bool allowPassed(const Message* mess) const;
+    bool allowPassed(const MessageView& mess) const;
 };
 
 /** filter for rerouting a packet to a particular endpoint*/
@@ -155,9 +156,9 @@ class CloneFilterOperation: public FilterOperations {
     virtual std::shared_ptr<FilterOperator> getOperator() override;
 
   private:
-    /** run the send message function which copies the message and forwards to all destinations
-    @param mess a message to clone*/
-    std::vector<std::unique_ptr<Message>> sendMessage(const Message* mess) const;
+    /** get the destinations to forward copies of a message to
+    @param destinations the container to append the delivery addresses to*/
+    void getDestinations(std::vector<std::string>& destinations) const;
 };
 
 } // namespace helics
@@ -62,6 +62,17 @@ HELICS_CXX_EXPORT bool changeDetected(const defV& prevValue, Time val, double de
 HELICS_CXX_EXPORT bool changeDetected(const defV& prevValue, const NamedPoint& val, double deltaV);
 HELICS_CXX_EXPORT bool changeDetected(const defV& prevValue, bool val, double deltaV);
 
+/** check if any element of two arrays of doubles differs by more than a tolerance
+@details the elements are compared in fixed size blocks without branches inside a block so the
+comparison is vectorized,  on x86 linux builds with gcc versions for AVX2 and AVX-512 are selected
+at runtime based on the processor
+@param prev the previous values
+@param vals the new values
+@param size the number of elements in each array
+@param deltaV the tolerance*/
+HELICS_CXX_EXPORT bool
+    vectorChangeDetected(const double* prev, const double* vals, size_t size, double deltaV);
+
 /** directly convert the boolean to integer*/
 inline int64_t make_valid(bool obj)
 {
@@ -204,6 +215,16 @@ std::enable_if_t<std::is_arithmetic<X>::value && (!std::is_same<X, char>::value)
     }
 }
 
+/** extract a double to a numerical type directly without constructing a variant*/
+template<class X>
+std::enable_if_t<
+    std::is_arithmetic<X>::value && (!std::is_same<X, char>::value) &&
+    (!std::is_same<X, bool>::value)>
+    valueExtract(double dv, X& val)
+{
+    val = static_cast<X>(dv);
+}
+
 /** assume it is some numeric type (int or double)*/
 template<class X>
 std::enable_if_t<std::is_arithmetic<X>::value>
@@ -269,7 +290,10 @@ std::enable_if_t<std::is_arithmetic<X>::value>
             break;
         }
         case data_type::helics_double: {
-            auto V = ValueConverter<double>::interpret(dv);
+            double V;
+            if (!detail::decodeDirect(dv, V)) {
+                V = ValueConverter<double>::interpret(dv);
+            }
             val = static_cast<X>(V);
             break;
         }
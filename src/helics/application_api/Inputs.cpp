@@ -141,7 +141,7 @@ bool Input::checkUpdate(bool assumeUpdate)
                 }
 
                 if (changeDetected(lastValue, newVal, delta)) {
-                    lastValue = newVal;
+                    lastValue = std::move(newVal);
                     hasUpdate = true;
                 }
             };
@@ -267,7 +267,10 @@ double doubleExtractAndConvert(
     const std::shared_ptr<units::precise_unit>& inputUnits,
     const std::shared_ptr<units::precise_unit>& outputUnits)
 {
-    auto V = ValueConverter<double>::interpret(dv);
+    double V;
+    if (!detail::decodeDirect(dv, V)) {
+        V = ValueConverter<double>::interpret(dv);
+    }
     if ((inputUnits) && (outputUnits)) {
         V = units::convert(V, *inputUnits, *outputUnits);
     }
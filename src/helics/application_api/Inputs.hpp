@@ -528,8 +528,8 @@ void Input::getValue_impl(std::integral_constant<int, primaryType> /*V*/, X& out
         }
 
         if (type == helics::data_type::helics_double) {
-            defV val = doubleExtractAndConvert(dv, inputUnits, outputUnits);
-            valueExtract(val, out);
+            // numeric outputs take the double directly,  others convert it through the variant
+            valueExtract(doubleExtractAndConvert(dv, inputUnits, outputUnits), out);
         } else if (type == helics::data_type::helics_int) {
             defV val;
             integerExtractAndConvert(val, dv, inputUnits, outputUnits);
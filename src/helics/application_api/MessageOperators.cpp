@@ -11,6 +11,19 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <utility>
 
 namespace helics {
+/** create a view of a Message object for operators processing a view of the message*/
+static MessageView viewMessage(Message& message)
+{
+    // the data_block holds a non const string so the cast is well defined
+    return {message.time,
+            message.messageID,
+            const_cast<std::string&>(message.data.to_string()),
+            message.dest,
+            message.original_dest,
+            message.source,
+            message.original_source};
+}
+
 MessageTimeOperator::MessageTimeOperator(std::function<Time(Time)> userTimeFunction):
     TimeFunction(std::move(userTimeFunction))
 {
@@ -24,6 +37,14 @@ std::unique_ptr<Message> MessageTimeOperator::process(std::unique_ptr<Message> m
     return message;
 }
 
+bool MessageTimeOperator::processInPlace(MessageView& message)
+{
+    if (TimeFunction) {
+        message.time = TimeFunction(message.time);
+    }
+    return true;
+}
+
 void MessageTimeOperator::setTimeFunction(std::function<Time(Time)> userTimeFunction)
 {
     TimeFunction = std::move(userTimeFunction);
@@ -69,6 +90,15 @@ std::unique_ptr<Message> MessageDestOperator::process(std::unique_ptr<Message> m
     return message;
 }
 
+bool MessageDestOperator::processInPlace(MessageView& message)
+{
+    if (DestUpdateFunction) {
+        message.original_dest = message.dest;
+        message.dest = DestUpdateFunction(message.source, message.dest);
+    }
+    return true;
+}
+
 MessageConditionalOperator::MessageConditionalOperator(
     std::function<bool(const Message*)> userConditionalFunction):
     evalFunction(std::move(userConditionalFunction))
@@ -81,6 +111,12 @@ void MessageConditionalOperator::setConditionFunction(
     evalFunction = std::move(userConditionalFunction);
 }
 
+void MessageConditionalOperator::setViewConditionFunction(
+    std::function<bool(const MessageView&)> userConditionalFunction)
+{
+    viewEvalFunction = std::move(userConditionalFunction);
+}
+
 std::unique_ptr<Message> MessageConditionalOperator::process(std::unique_ptr<Message> message)
 {
     if (evalFunction) {
@@ -89,9 +125,20 @@ std::unique_ptr<Message> MessageConditionalOperator::process(std::unique_ptr<Mes
         }
         return nullptr;
     }
+    if (viewEvalFunction) {
+        if (viewEvalFunction(viewMessage(*message))) {
+            return message;
+        }
+        return nullptr;
+    }
     return message;
 }
 
+bool MessageConditionalOperator::processInPlace(MessageView& message)
+{
+    return (viewEvalFunction) ? viewEvalFunction(message) : true;
+}
+
 CloneOperator::CloneOperator(
     std::function<std::vector<std::unique_ptr<Message>>(const Message*)> userCloneFunction):
     evalFunction(std::move(userCloneFunction))
@@ -104,6 +151,12 @@ void CloneOperator::setCloneFunction(
     evalFunction = std::move(userCloneFunction);
 }
 
+void CloneOperator::setCloneDestinationFunction(
+    std::function<void(const MessageView&, std::vector<std::string>&)> userDestinationFunction)
+{
+    destinationFunction = std::move(userDestinationFunction);
+}
+
 std::unique_ptr<Message> CloneOperator::process(std::unique_ptr<Message> message)
 {
     if (evalFunction) {
@@ -111,6 +164,13 @@ std::unique_ptr<Message> CloneOperator::process(std::unique_ptr<Message> message
         if (res.size() == 1) {
             return std::move(res.front());
         }
+    } else if (destinationFunction) {
+        std::vector<std::string> destinations;
+        destinationFunction(viewMessage(*message), destinations);
+        if (destinations.size() == 1) {
+            message->original_dest = message->dest;
+            message->dest = std::move(destinations.front());
+        }
     }
     return message;
 }
@@ -120,7 +180,26 @@ std::vector<std::unique_ptr<Message>> CloneOperator::processVector(std::unique_p
     if (evalFunction) {
         return evalFunction(message.get());
     }
-    return {};
+    std::vector<std::unique_ptr<Message>> messages;
+    if (destinationFunction) {
+        std::vector<std::string> destinations;
+        destinationFunction(viewMessage(*message), destinations);
+        for (auto& dest : destinations) {
+            messages.push_back(std::make_unique<Message>(*message));
+            messages.back()->original_dest = message->dest;
+            messages.back()->dest = std::move(dest);
+        }
+    }
+    return messages;
+}
+
+void CloneOperator::getCloneDestinations(
+    const MessageView& message,
+    std::vector<std::string>& destinations)
+{
+    if (destinationFunction) {
+        destinationFunction(message, destinations);
+    }
 }
 
 FirewallOperator::FirewallOperator(std::function<bool(const Message*)> userCheckFunction):
@@ -133,10 +212,17 @@ void FirewallOperator::setCheckFunction(std::function<bool(const Message*)> user
     checkFunction = std::move(userCheckFunction);
 }
 
+void FirewallOperator::setViewCheckFunction(
+    std::function<bool(const MessageView&)> userCheckFunction)
+{
+    viewCheckFunction = std::move(userCheckFunction);
+}
+
 std::unique_ptr<Message> FirewallOperator::process(std::unique_ptr<Message> message)
 {
-    if (checkFunction) {
-        bool res = checkFunction(message.get());
+    if (checkFunction || viewCheckFunction) {
+        bool res = (checkFunction) ? checkFunction(message.get()) :
+                                     viewCheckFunction(viewMessage(*message));
         switch (operation) {
             case operations::drop:
                 if (res) {
@@ -170,6 +256,23 @@ std::unique_ptr<Message> FirewallOperator::process(std::unique_ptr<Message> mess
     return message;
 }
 
+bool FirewallOperator::processInPlace(MessageView& message)
+{
+    if (!viewCheckFunction) {
+        return true;
+    }
+    bool res = viewCheckFunction(message);
+    switch (operation) {
+        case operations::drop:
+            return !res;
+        case operations::pass:
+            return res;
+        default:
+            // the core does not carry message flags so the flag operations pass the message
+            return true;
+    }
+}
+
 CustomMessageOperator::CustomMessageOperator(
     std::function<std::unique_ptr<Message>(std::unique_ptr<Message>)> userMessageFunction):
     messageFunction(std::move(userMessageFunction))
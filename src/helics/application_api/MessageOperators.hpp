@@ -29,6 +29,8 @@ class HELICS_CXX_EXPORT MessageTimeOperator: public FilterOperator {
     explicit MessageTimeOperator(std::function<Time(Time)> userTimeFunction);
     /** set the function to modify the time of the message*/
     void setTimeFunction(std::function<Time(Time)> userTimeFunction);
+    virtual bool isInPlace() const override { return true; }
+    virtual bool processInPlace(MessageView& message) override;
 
   private:
     std::function<Time(Time)> TimeFunction; //!< the function that actually does the processing
@@ -46,6 +48,8 @@ class HELICS_CXX_EXPORT MessageDestOperator: public FilterOperator {
     /** set the function to modify the time of the message*/
     void setDestFunction(
         std::function<std::string(const std::string&, const std::string&)> userDestFunction);
+    virtual bool isInPlace() const override { return true; }
+    virtual bool processInPlace(MessageView& message) override;
 
   private:
     std::function<std::string(const std::string&, const std::string&)>
@@ -82,10 +86,18 @@ class HELICS_CXX_EXPORT MessageConditionalOperator: public FilterOperator {
         std::function<bool(const Message*)> userConditionalFunction);
     /** set the function to modify the data of the message*/
     void setConditionFunction(std::function<bool(const Message*)> userConditionFunction);
+    /** set a function evaluating the condition on a view of the message
+    @details the message can then be filtered in place,  a function set through
+    setConditionFunction takes precedence*/
+    void setViewConditionFunction(std::function<bool(const MessageView&)> userConditionFunction);
+    virtual bool isInPlace() const override { return !evalFunction; }
+    virtual bool processInPlace(MessageView& message) override;
 
   private:
     std::function<bool(const Message*)>
         evalFunction; //!< the function actually doing the processing
+    std::function<bool(const MessageView&)>
+        viewEvalFunction; //!< the function doing the processing on a message view
     virtual std::unique_ptr<Message> process(std::unique_ptr<Message> message) override;
 };
 
@@ -103,10 +115,21 @@ class HELICS_CXX_EXPORT CloneOperator: public FilterOperator {
     /** set the function to modify the data of the message*/
     void setCloneFunction(
         std::function<std::vector<std::unique_ptr<Message>>(const Message*)> userCloneFunction);
+    /** set a function generating the destinations of the copies of a message
+    @details the copies can then be generated directly from the original message,  a function set
+    through setCloneFunction takes precedence*/
+    void setCloneDestinationFunction(
+        std::function<void(const MessageView&, std::vector<std::string>&)> userDestinationFunction);
+    virtual bool isInPlace() const override { return !evalFunction; }
+    virtual void getCloneDestinations(
+        const MessageView& message,
+        std::vector<std::string>& destinations) override;
 
   private:
     std::function<std::vector<std::unique_ptr<Message>>(const Message*)>
         evalFunction; //!< the function actually doing the processing
+    std::function<void(const MessageView&, std::vector<std::string>&)>
+        destinationFunction; //!< the function generating the destinations of the copies
     virtual std::unique_ptr<Message> process(std::unique_ptr<Message> message) override;
     virtual std::vector<std::unique_ptr<Message>>
         processVector(std::unique_ptr<Message> message) override;
@@ -133,12 +156,20 @@ class HELICS_CXX_EXPORT FirewallOperator: public FilterOperator {
     explicit FirewallOperator(std::function<bool(const Message*)> userCheckFunction);
     /** set the function to modify the data of the message*/
     void setCheckFunction(std::function<bool(const Message*)> userCheckFunction);
+    /** set a function checking a view of the message
+    @details the message can then be filtered in place,  a function set through setCheckFunction
+    takes precedence*/
+    void setViewCheckFunction(std::function<bool(const MessageView&)> userCheckFunction);
     /** set the operation to perform on positive checkFunction*/
     void setOperation(operations newop) { operation.store(newop); }
+    virtual bool isInPlace() const override { return !checkFunction; }
+    virtual bool processInPlace(MessageView& message) override;
 
   private:
     std::function<bool(const Message*)>
         checkFunction; //!< the function actually doing the processing
+    std::function<bool(const MessageView&)>
+        viewCheckFunction; //!< the function doing the processing on a message view
     std::atomic<operations> operation{
         operations::drop}; //!< the operation to perform if the firewall triggers
     virtual std::unique_ptr<Message> process(std::unique_ptr<Message> message) override;
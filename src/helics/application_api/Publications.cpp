@@ -81,8 +81,15 @@ void Publication::publish(double val)
         }
     }
     if (doPublish) {
-        auto db = typeConvert(pubType, val);
-        fed->publishRaw(*this, db);
+        if (pubType == data_type::helics_double) {
+            // the double encoding has a fixed size so it is written directly into a local buffer
+            char buffer[detail::doubleEncodingSize];
+            detail::encodeDirect(val, buffer);
+            fed->publishRaw(*this, data_view(buffer, detail::doubleEncodingSize));
+        } else {
+            auto db = typeConvert(pubType, val);
+            fed->publishRaw(*this, db);
+        }
     }
 }
 void Publication::publishInt(int64_t val)
@@ -216,7 +223,12 @@ void Publication::publish(const double* vals, int size)
     bool doPublish = true;
     if (changeDetectionEnabled) {
         if (changeDetected(prevValue, vals, size, delta)) {
-            prevValue = std::vector<double>(vals, vals + size);
+            if (prevValue.index() == vector_loc) {
+                // reuse the storage of the previous vector
+                mpark::get<std::vector<double>>(prevValue).assign(vals, vals + size);
+            } else {
+                prevValue = std::vector<double>(vals, vals + size);
+            }
         } else {
             doPublish = false;
         }
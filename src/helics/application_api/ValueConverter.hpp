@@ -15,8 +15,12 @@ the purpose of these objects are to convert a specific type into a data block fo
 #include "data_view.hpp"
 #include "helicsTypes.hpp"
 
+#include <complex>
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <utility>
+#include <vector>
 namespace helics {
 /** converter for a basic value*/
 template<class X>
@@ -57,6 +61,82 @@ class ValueConverter<std::string> {
     static void interpret(const data_view& block, std::string& val) { val = interpret(block); }
     static std::string type() { return "string"; }
 };
+
+namespace detail {
+    /** get the marker byte the standard encoding starts with for data in the byte order of this
+    machine*/
+    inline char nativeEncodingMarker()
+    {
+        static const std::int32_t test{1};
+        static const char marker = (*reinterpret_cast<const std::int8_t*>(&test) == 1) ? 1 : 0;
+        return marker;
+    }
+
+    /** check that a data block is in the standard encoding with the byte order of this machine
+    @details the standard encoding of fixed size values is the marker byte followed by the raw
+    values so matching data can be copied in and out directly*/
+    inline bool isNativeEncoding(const data_view& dv)
+    {
+        return !dv.empty() && (dv[0] == nativeEncodingMarker());
+    }
+
+    /** the size of the standard encoding of a double*/
+    constexpr std::size_t doubleEncodingSize{sizeof(double) + 1};
+
+    /** encode a double in the standard encoding without going through the serialization archive
+    @details produces the same bytes as ValueConverter<double>::convert
+    @param val the value to encode
+    @param buffer storage for at least doubleEncodingSize bytes*/
+    inline void encodeDirect(double val, char* buffer)
+    {
+        buffer[0] = nativeEncodingMarker();
+        std::memcpy(buffer + 1, &val, sizeof(double));
+    }
+
+    /** decode a double in the standard encoding without going through the serialization archive
+    @return false if the data is not a double in the byte order of this machine*/
+    inline bool decodeDirect(const data_view& dv, double& val)
+    {
+        if (dv.size() != doubleEncodingSize || !isNativeEncoding(dv)) {
+            return false;
+        }
+        std::memcpy(&val, dv.data() + 1, sizeof(double));
+        return true;
+    }
+
+    /** decode a complex value in the standard encoding without the serialization archive*/
+    inline bool decodeDirect(const data_view& dv, std::complex<double>& val)
+    {
+        if (dv.size() != 2 * sizeof(double) + 1 || !isNativeEncoding(dv)) {
+            return false;
+        }
+        double parts[2];
+        std::memcpy(parts, dv.data() + 1, 2 * sizeof(double));
+        val = std::complex<double>(parts[0], parts[1]);
+        return true;
+    }
+
+    /** decode a vector in the standard encoding without the serialization archive
+    @details vectors are encoded with an 8 byte element count ahead of the values*/
+    inline bool decodeDirect(const data_view& dv, std::vector<double>& val)
+    {
+        constexpr std::size_t headerSize{sizeof(std::uint64_t) + 1};
+        if (dv.size() < headerSize || !isNativeEncoding(dv)) {
+            return false;
+        }
+        std::uint64_t count{0};
+        std::memcpy(&count, dv.data() + 1, sizeof(std::uint64_t));
+        if (count != (dv.size() - headerSize) / sizeof(double) ||
+            dv.size() != headerSize + count * sizeof(double)) {
+            return false;
+        }
+        val.resize(static_cast<std::size_t>(count));
+        if (count > 0) {
+            std::memcpy(val.data(), dv.data() + headerSize, val.size() * sizeof(double));
+        }
+        return true;
+    }
+} // namespace detail
 } // namespace helics
 
 // This should be at the end since it depends on the definitions in here
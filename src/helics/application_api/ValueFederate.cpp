@@ -381,6 +381,30 @@ const std::string& ValueFederate::getString(Input& inp)
     return inp.getValueRef<std::string>();
 }
 
+void ValueFederate::getValueBatch(
+    const std::vector<Input*>& inps,
+    double* vals,
+    std::uint64_t* updated)
+{
+    vfManager->getValueBatch(inps, vals, updated);
+}
+
+void ValueFederate::getValueBatch(
+    const std::vector<Input*>& inps,
+    std::complex<double>* vals,
+    std::uint64_t* updated)
+{
+    vfManager->getValueBatch(inps, vals, updated);
+}
+
+void ValueFederate::getValueBatch(
+    const std::vector<Input*>& inps,
+    std::vector<double>* vals,
+    std::uint64_t* updated)
+{
+    vfManager->getValueBatch(inps, vals, updated);
+}
+
 void ValueFederate::publishRaw(const Publication& pub, data_view block)
 {
     if ((currentMode == modes::executing) || (currentMode == modes::initializing)) {
@@ -391,6 +415,18 @@ void ValueFederate::publishRaw(const Publication& pub, data_view block)
     }
 }
 
+void ValueFederate::publishBatch(
+    const std::vector<Publication*>& pubs,
+    const std::vector<double>& vals)
+{
+    if ((currentMode == modes::executing) || (currentMode == modes::initializing)) {
+        vfManager->publishBatch(pubs, vals);
+    } else {
+        throw(InvalidFunctionCall(
+            "publications not allowed outside of execution and initialization state"));
+    }
+}
+
 void ValueFederate::publish(Publication& pub, const std::string& str)
 {
     pub.publish(str);
@@ -11,6 +11,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "ValueConverter.hpp"
 #include "data_view.hpp"
 
+#include <complex>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -439,6 +441,31 @@ class HELICS_CXX_EXPORT ValueFederate:
     double getDouble(Input& inp);
     /** get a string value*/
     const std::string& getString(Input& inp);
+    /** get the double values of several inputs in a single operation
+    @details the results match calling getValue<double> on each input,  inputs of double type
+    without change detection or unit conversion are decoded directly from the received data
+    @param inps the inputs to get the values of
+    @param vals storage for the values,  at least inps.size() elements
+    @param updated optional bitmask of at least (inps.size()+63)/64 words,  bit ii%64 of word ii/64
+    is set if input ii was updated since its last read,  may be nullptr
+    @throw InvalidIdentifier if an input does not belong to the federate
+    */
+    void getValueBatch(
+        const std::vector<Input*>& inps,
+        double* vals,
+        std::uint64_t* updated = nullptr);
+    /** get the complex values of several inputs in a single operation
+    @details the arguments match the double version*/
+    void getValueBatch(
+        const std::vector<Input*>& inps,
+        std::complex<double>* vals,
+        std::uint64_t* updated = nullptr);
+    /** get the vector values of several inputs in a single operation
+    @details the arguments match the double version*/
+    void getValueBatch(
+        const std::vector<Input*>& inps,
+        std::vector<double>* vals,
+        std::uint64_t* updated = nullptr);
     /** publish a value
     @param pub the publication identifier
     @param block a data block containing the data
@@ -457,6 +484,16 @@ class HELICS_CXX_EXPORT ValueFederate:
         publishRaw(pub, data_view{data, data_size});
     }
 
+    /** publish double values on several publications in a single operation
+    @details the change detection and type conversion of each publication are applied as in
+    Publication::publish and the values are passed to the core together
+    @param pubs the publications to publish on
+    @param vals the values to publish,  one for each publication
+    @throw InvalidParameter if the number of values does not match the number of publications
+    @throw InvalidIdentifier if a publication does not belong to the federate
+    */
+    void publishBatch(const std::vector<Publication*>& pubs, const std::vector<double>& vals);
+
     /** direct publish a string
    @param pub the publication to use
    @param str a string to publish
@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Inputs.hpp"
 #include "Publications.hpp"
 
+#include <algorithm>
 #include <utility>
 namespace helics {
 ValueFederateManager::ValueFederateManager(Core* coreOb, ValueFederate* vfed, local_federate_id id):
@@ -191,6 +192,70 @@ data_view ValueFederateManager::getValue(const Input& inp)
     return data_view();
 }
 
+template<class X>
+void ValueFederateManager::getValueBatchImpl(
+    const std::vector<Input*>& inps,
+    X* vals,
+    std::uint64_t* updated)
+{
+    if (updated != nullptr) {
+        std::fill(updated, updated + (inps.size() + 63) / 64, std::uint64_t(0));
+    }
+    for (std::size_t ii = 0; ii < inps.size(); ++ii) {
+        auto* inp = inps[ii];
+        if (inp == nullptr || inp->fed != fed) {
+            throw(InvalidIdentifier("input is not valid for this federate"));
+        }
+        auto iData = reinterpret_cast<input_info*>(inp->dataReference);
+        bool isUpdated{false};
+        if ((iData == nullptr) || inp->changeDetectionEnabled || (inp->type != helicsType<X>()) ||
+            (inp->inputUnits && inp->outputUnits)) {
+            isUpdated = inp->isUpdated();
+            inp->getValue(vals[ii]);
+        } else {
+            // this mirrors Input::getValue without the variant and unit handling
+            isUpdated = inp->hasUpdate || iData->hasUpdate;
+            if (isUpdated) {
+                auto dv = getValue(*inp);
+                if (!detail::decodeDirect(dv, vals[ii])) {
+                    valueExtract(dv, inp->type, vals[ii]);
+                }
+                inp->lastValue = vals[ii];
+            } else {
+                valueExtract(inp->lastValue, vals[ii]);
+            }
+            inp->hasUpdate = false;
+        }
+        if (isUpdated && updated != nullptr) {
+            updated[ii / 64] |= (std::uint64_t(1) << (ii % 64));
+        }
+    }
+}
+
+void ValueFederateManager::getValueBatch(
+    const std::vector<Input*>& inps,
+    double* vals,
+    std::uint64_t* updated)
+{
+    getValueBatchImpl(inps, vals, updated);
+}
+
+void ValueFederateManager::getValueBatch(
+    const std::vector<Input*>& inps,
+    std::complex<double>* vals,
+    std::uint64_t* updated)
+{
+    getValueBatchImpl(inps, vals, updated);
+}
+
+void ValueFederateManager::getValueBatch(
+    const std::vector<Input*>& inps,
+    std::vector<double>* vals,
+    std::uint64_t* updated)
+{
+    getValueBatchImpl(inps, vals, updated);
+}
+
 /** function to check if the size is valid for the given type*/
 inline bool isBlockSizeValid(int size, const publication_info& pubI)
 {
@@ -202,6 +267,34 @@ void ValueFederateManager::publish(const Publication& pub, const data_view& bloc
     coreObject->setValue(pub.handle, block.data(), block.size());
 }
 
+void ValueFederateManager::publishBatch(
+    const std::vector<Publication*>& pubs,
+    const std::vector<double>& vals)
+{
+    if (pubs.size() != vals.size()) {
+        throw(InvalidParameter("the number of values does not match the number of publications"));
+    }
+    std::vector<interface_handle> handles;
+    std::vector<data_block> blocks;
+    handles.reserve(pubs.size());
+    blocks.reserve(pubs.size());
+    for (std::size_t ii = 0; ii < pubs.size(); ++ii) {
+        auto* pub = pubs[ii];
+        if (pub == nullptr || pub->fed != fed) {
+            throw(InvalidIdentifier("publication is not valid for this federate"));
+        }
+        if (pub->changeDetectionEnabled) {
+            if (!changeDetected(pub->prevValue, vals[ii], pub->delta)) {
+                continue;
+            }
+            pub->prevValue = vals[ii];
+        }
+        handles.push_back(pub->handle);
+        blocks.push_back(typeConvert(pub->pubType, vals[ii]));
+    }
+    coreObject->setValues(handles, blocks);
+}
+
 bool ValueFederateManager::hasUpdate(const Input& inp) const
 {
     auto iData = reinterpret_cast<input_info*>(inp.dataReference);
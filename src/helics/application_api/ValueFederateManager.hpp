@@ -14,6 +14,8 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "gmlc/containers/DualMappedVector.hpp"
 #include "helicsTypes.hpp"
 
+#include <complex>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -129,6 +131,25 @@ class ValueFederateManager {
 
     /** publish a value*/
     void publish(const Publication& pub, const data_view& block);
+    /** publish double values on a set of publications in a single core operation
+    @details the change detection and type conversion of each publication are applied*/
+    void publishBatch(const std::vector<Publication*>& pubs, const std::vector<double>& vals);
+
+    /** get the values of a set of inputs in a single operation
+    @details inputs of the matching type without change detection or unit conversion are decoded
+    directly from the received data,  all others go through Input::getValue
+    @param inps the inputs to read
+    @param vals storage for at least inps.size() values
+    @param updated optional bitmask with a bit set for each input that was updated*/
+    void getValueBatch(const std::vector<Input*>& inps, double* vals, std::uint64_t* updated);
+    void getValueBatch(
+        const std::vector<Input*>& inps,
+        std::complex<double>* vals,
+        std::uint64_t* updated);
+    void getValueBatch(
+        const std::vector<Input*>& inps,
+        std::vector<double>* vals,
+        std::uint64_t* updated);
 
     /** check if a given subscription has and update*/
     bool hasUpdate(const Input& inp) const;
@@ -228,6 +249,8 @@ class ValueFederateManager {
         inputTargets; //!< container for the specified input targets
   private:
     void getUpdateFromCore(interface_handle handle);
+    template<class X>
+    void getValueBatchImpl(const std::vector<Input*>& inps, X* vals, std::uint64_t* updated);
 };
 
 } // namespace helics
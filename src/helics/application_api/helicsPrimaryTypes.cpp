@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../utilities/timeStringOps.hpp"
 #include "ValueConverter.hpp"
 
+#include <cstdlib>
 #include <set>
 namespace helics {
 bool changeDetected(const defV& prevValue, const std::string& val, double /*deltaV*/)
@@ -65,17 +66,46 @@ bool changeDetected(const defV& prevValue, bool val, double /*deltaV*/)
     return true;
 }
 
+// gcc 6 and later on x86 linux can generate versions of a function for several instruction sets
+// and select one at load time,  the selection uses ifunc which requires glibc
+#if defined(__GNUC__) && (__GNUC__ >= 6) && !defined(__clang__) && defined(__x86_64__) &&          \
+    defined(__linux__) && defined(__GLIBC__)
+#    define HELICS_VECTOR_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#    define HELICS_VECTOR_CLONES
+#endif
+
+/** the number of elements compared between checks for a change*/
+static constexpr size_t changeBlockSize{32};
+
+HELICS_VECTOR_CLONES bool
+    vectorChangeDetected(const double* prev, const double* vals, size_t size, double deltaV)
+{
+    size_t ii{0};
+    for (; ii + changeBlockSize <= size; ii += changeBlockSize) {
+        // no early exit inside the block so the loop can be vectorized
+        int changed{0};
+        for (size_t jj = ii; jj < ii + changeBlockSize; ++jj) {
+            changed |= static_cast<int>(std::abs(prev[jj] - vals[jj]) > deltaV);
+        }
+        if (changed != 0) {
+            return true;
+        }
+    }
+    for (; ii < size; ++ii) {
+        if (std::abs(prev[ii] - vals[ii]) > deltaV) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool changeDetected(const defV& prevValue, const std::vector<double>& val, double deltaV)
 {
     if (prevValue.index() == vector_loc) {
         const auto& prevV = mpark::get<std::vector<double>>(prevValue);
         if (val.size() == prevV.size()) {
-            for (size_t ii = 0; ii < val.size(); ++ii) {
-                if (std::abs(prevV[ii] - val[ii]) > deltaV) {
-                    return true;
-                }
-            }
-            return false;
+            return vectorChangeDetected(prevV.data(), val.data(), val.size(), deltaV);
         }
     }
     return true;
@@ -105,12 +135,7 @@ bool changeDetected(const defV& prevValue, const double* vals, size_t size, doub
     if (prevValue.index() == vector_loc) {
         const auto& prevV = mpark::get<std::vector<double>>(prevValue);
         if (size == prevV.size()) {
-            for (size_t ii = 0; ii < size; ++ii) {
-                if (std::abs(prevV[ii] - vals[ii]) > deltaV) {
-                    return true;
-                }
-            }
-            return false;
+            return vectorChangeDetected(prevV.data(), vals, size, deltaV);
         }
     }
     return true;
@@ -175,7 +200,7 @@ void valueExtract(const defV& dv, std::string& val)
 {
     switch (dv.index()) {
         case double_loc: // double
-            val = std::to_string(mpark::get<double>(dv));
+            val = helicsDoubleString(mpark::get<double>(dv));
             break;
         case int_loc: // int64_t
             val = std::to_string(mpark::get<int64_t>(dv));
@@ -516,7 +541,7 @@ void valueExtract(const data_view& dv, data_type baseType, std::string& val)
     switch (baseType) {
         case data_type::helics_double: {
             auto V = ValueConverter<double>::interpret(dv);
-            val = std::to_string(V);
+            val = helicsDoubleString(V);
             break;
         }
         case data_type::helics_int:
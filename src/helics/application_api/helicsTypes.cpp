@@ -7,11 +7,14 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "helicsTypes.hpp"
 
+#include "../common/fmt_format.h"
 #include "ValueConverter.hpp"
 #include "gmlc/utilities/demangle.hpp"
 #include "gmlc/utilities/stringConversion.h"
 
 #include <algorithm>
+#include <cfloat>
+#include <cstdint>
 #include <functional>
 #include <numeric>
 #include <regex>
@@ -70,14 +73,32 @@ double vectorNorm(const std::vector<std::complex<double>>& vec)
         }));
 }
 
+/** append the shortest string representation of a double that reads back as the same value*/
+static void appendDouble(std::string& str, double val)
+{
+    // the longest shortest representation is 24 characters like -2.2250738585072014e-308
+    char buffer[32];
+    auto res = fmt::format_to_n(buffer, sizeof(buffer), "{}", val);
+    str.append(buffer, res.size);
+}
+
+std::string helicsDoubleString(double val)
+{
+    std::string str;
+    appendDouble(str, val);
+    return str;
+}
+
 std::string helicsComplexString(double real, double imag)
 {
-    std::stringstream ss;
-    ss << real;
+    std::string str;
+    appendDouble(str, real);
     if (imag != 0.0) {
-        ss << ((imag >= 0.0) ? '+' : ' ') << imag << 'j';
+        str.push_back((imag >= 0.0) ? '+' : ' ');
+        appendDouble(str, imag);
+        str.push_back('j');
     }
-    return ss.str();
+    return str;
 }
 
 std::string helicsComplexString(std::complex<double> val)
@@ -188,6 +209,175 @@ data_type getTypeFromString(const std::string& typeName)
     return res->second;
 }
 
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+static constexpr bool fastDecimalParse{true};
+#else
+// intermediate results with extra precision would round twice in the fast path
+static constexpr bool fastDecimalParse{false};
+#endif
+
+/** the powers of 10 that are exactly representable as a double*/
+static constexpr double exactPowersOf10[]{1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                          1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                          1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+static inline bool isDigit(char c)
+{
+    return (c >= '0') && (c <= '9');
+}
+
+/** parse a decimal number at the start of a character range
+@details the number is an optional sign, digits with an optional fraction, and an optional exponent,
+the same grammar the complex regular expression accepts.  Only numbers with at most 19 significant
+digits whose value is a 53 bit integer scaled by an exact power of 10 are handled, those are
+correctly rounded by a single floating point multiplication or division
+@param start the first character of the number
+@param end the end of the character range
+@param val the location to store the value
+@return a pointer to the character after the number or nullptr if the number is not handled*/
+static const char* parseDecimal(const char* start, const char* end, double& val)
+{
+    if (!fastDecimalParse) {
+        return nullptr;
+    }
+    const char* pos = start;
+    bool negative{false};
+    if ((pos != end) && ((*pos == '-') || (*pos == '+'))) {
+        negative = (*pos == '-');
+        ++pos;
+    }
+    std::uint64_t mantissa{0};
+    int significantDigits{0};
+    int exponent{0};
+    const char* intStart = pos;
+    while ((pos != end) && isDigit(*pos)) {
+        if ((mantissa != 0) || (*pos != '0')) {
+            ++significantDigits;
+        }
+        mantissa = mantissa * 10 + static_cast<std::uint64_t>(*pos - '0');
+        ++pos;
+    }
+    bool hasDigits = (pos != intStart);
+    if ((pos != end) && (*pos == '.')) {
+        ++pos;
+        const char* fracStart = pos;
+        while ((pos != end) && isDigit(*pos)) {
+            if ((mantissa != 0) || (*pos != '0')) {
+                ++significantDigits;
+            }
+            mantissa = mantissa * 10 + static_cast<std::uint64_t>(*pos - '0');
+            --exponent;
+            ++pos;
+        }
+        if (pos == fracStart) {
+            return nullptr;
+        }
+        hasDigits = true;
+    }
+    // more than 19 digits could overflow the mantissa
+    if (!hasDigits || significantDigits > 19) {
+        return nullptr;
+    }
+    if ((pos != end) && ((*pos == 'e') || (*pos == 'E'))) {
+        ++pos;
+        bool negativeExponent{false};
+        if ((pos != end) && ((*pos == '-') || (*pos == '+'))) {
+            negativeExponent = (*pos == '-');
+            ++pos;
+        }
+        const char* expStart = pos;
+        int expValue{0};
+        while ((pos != end) && isDigit(*pos)) {
+            if (expValue < 10000) {
+                expValue = expValue * 10 + (*pos - '0');
+            }
+            ++pos;
+        }
+        if (pos == expStart) {
+            return nullptr;
+        }
+        exponent += (negativeExponent) ? -expValue : expValue;
+    }
+    if (mantissa == 0) {
+        val = (negative) ? -0.0 : 0.0;
+        return pos;
+    }
+    if ((mantissa > (std::uint64_t{1} << 53U)) || (exponent < -22) || (exponent > 22)) {
+        return nullptr;
+    }
+    double result = static_cast<double>(mantissa);
+    if (exponent < 0) {
+        result /= exactPowersOf10[-exponent];
+    } else {
+        result *= exactPowersOf10[exponent];
+    }
+    val = (negative) ? -result : result;
+    return pos;
+}
+
+/** parse a character range containing only a decimal number and surrounding spaces
+@return true if the fast path handled the number*/
+static bool parseDecimalString(const char* start, const char* end, double& val)
+{
+    while ((start != end) && (*start == ' ')) {
+        ++start;
+    }
+    while ((end != start) && (*(end - 1) == ' ')) {
+        --end;
+    }
+    return (start != end) && (parseDecimal(start, end, val) == end);
+}
+
+/** parse the common complex forms A, Aj, and A+Bj without the regular expression
+@return true if the string was handled*/
+static bool parseComplexFast(const std::string& val, std::complex<double>& result)
+{
+    const char* end = val.data() + val.size();
+    double re{0.0};
+    const char* pos = parseDecimal(val.data(), end, re);
+    if (pos == nullptr) {
+        return false;
+    }
+    if (pos == end) {
+        result = {re, 0.0};
+        return true;
+    }
+    if ((*pos == 'j') || (*pos == 'i')) {
+        if (pos + 1 != end) {
+            return false;
+        }
+        result = {0.0, re};
+        return true;
+    }
+    while ((pos != end) && (*pos == ' ')) {
+        ++pos;
+    }
+    if ((pos == end) || ((*pos != '+') && (*pos != '-'))) {
+        return false;
+    }
+    bool negative = (*pos == '-');
+    ++pos;
+    while ((pos != end) && (*pos == ' ')) {
+        ++pos;
+    }
+    if ((pos == end) || (*pos == '+') || (*pos == '-')) {
+        return false;
+    }
+    double im{0.0};
+    pos = parseDecimal(pos, end, im);
+    if (pos == nullptr) {
+        return false;
+    }
+    while ((pos != end) && ((*pos == 'j') || (*pos == 'i'))) {
+        ++pos;
+    }
+    if (pos != end) {
+        return false;
+    }
+    result = {re, (negative) ? -im : im};
+    return true;
+}
+
 // regular expression to handle complex numbers of various formats
 const std::regex creg(
     R"(([+-]?(\d+(\.\d+)?|\.\d+)([eE][+-]?\d+)?)\s*([+-]\s*(\d+(\.\d+)?|\.\d+)([eE][+-]?\d+)?)[ji]*)");
@@ -197,6 +387,10 @@ std::complex<double> helicsGetComplex(const std::string& val)
     if (val.empty()) {
         return invalidValue<std::complex<double>>();
     }
+    std::complex<double> result;
+    if (parseComplexFast(val, result)) {
+        return result;
+    }
     std::smatch m;
     double re{invalidValue<double>()};
     double im{0.0};
@@ -205,7 +399,7 @@ std::complex<double> helicsGetComplex(const std::string& val)
         if (m.size() == 9) {
             re = numConv<double>(m[1]);
 
-            im = numConv<double>(m[6]);
+            im = numConv<double>(m[6].str() + m[8].str());
 
             if (*m[5].first == '-') {
                 im = -im;
@@ -235,7 +429,7 @@ std::string helicsVectorString(const std::vector<double>& val)
     vString.append(std::to_string(val.size()));
     vString.push_back('[');
     for (const auto& v : val) {
-        vString.append(std::to_string(v));
+        appendDouble(vString, v);
         vString.push_back(';');
         vString.push_back(' ');
     }
@@ -254,7 +448,7 @@ std::string helicsVectorString(const double* vals, size_t size)
     vString.append(std::to_string(size));
     vString.push_back('[');
     for (size_t ii = 0; ii < size; ++ii) {
-        vString.append(std::to_string(vals[ii]));
+        appendDouble(vString, vals[ii]);
         vString.push_back(';');
         vString.push_back(' ');
     }
@@ -299,7 +493,7 @@ std::string helicsNamedPointString(const std::string& pointName, double val)
     }
     retStr.push_back('"');
     retStr.push_back(':');
-    retStr.append(std::to_string(val));
+    appendDouble(retStr, val);
     retStr.push_back('}');
     return retStr;
 }
@@ -314,7 +508,7 @@ std::string helicsNamedPointString(const char* pointName, double val)
     }
     retStr.push_back('"');
     retStr.push_back(':');
-    retStr.append(std::to_string(val));
+    appendDouble(retStr, val);
     retStr.push_back('}');
     return retStr;
 }
@@ -359,8 +553,10 @@ NamedPoint helicsGetNamedPoint(const std::string& val)
     NamedPoint point;
     point.name = stringOps::removeQuotes(str1);
     auto vstr = val.substr(locsep + 1, locend - locsep - 1);
-    stringOps::trimString(vstr);
-    point.value = numConv<double>(vstr);
+    if (!parseDecimalString(vstr.data(), vstr.data() + vstr.size(), point.value)) {
+        stringOps::trimString(vstr);
+        point.value = numConv<double>(vstr);
+    }
     return point;
 }
 
@@ -431,10 +627,14 @@ void helicsGetVector(const std::string& val, std::vector<double>& data)
         auto fb = val.find_first_of('[');
         for (decltype(sz) ii = 0; ii < sz; ++ii) {
             auto nc = val.find_first_of(";,]", fb + 1);
-
-            std::string vstr = val.substr(fb + 1, nc - fb - 1);
-            stringOps::trimString(vstr);
-            auto V = numeric_conversion<double>(vstr, invalidValue<double>());
+            double V{0.0};
+            if ((fb == std::string::npos) ||
+                !parseDecimalString(
+                    val.data() + fb + 1, val.data() + std::min(nc, val.size()), V)) {
+                std::string vstr = val.substr(fb + 1, nc - fb - 1);
+                stringOps::trimString(vstr);
+                V = numeric_conversion<double>(vstr, invalidValue<double>());
+            }
             data.push_back(V);
 
             fb = nc;
@@ -478,17 +678,26 @@ void helicsGetComplexVector(const std::string& val, std::vector<std::complex<dou
         for (decltype(sz) ii = 0; ii < sz - 1; ii += 2) {
             auto nc = val.find_first_of(",;]", fb + 1);
             auto nc2 = val.find_first_of(",;]", nc + 1);
-            try {
-                std::string vstr1 = val.substr(fb + 1, nc - fb - 1);
-                stringOps::trimString(vstr1);
-                std::string vstr2 = val.substr(nc + 1, nc2 - nc - 1);
-                stringOps::trimString(vstr2);
-                auto V1 = numConv<double>(vstr1);
-                auto V2 = numConv<double>(vstr2);
+            double V1{0.0};
+            double V2{0.0};
+            if ((fb != std::string::npos) && (nc != std::string::npos) &&
+                (nc2 != std::string::npos) &&
+                parseDecimalString(val.data() + fb + 1, val.data() + nc, V1) &&
+                parseDecimalString(val.data() + nc + 1, val.data() + nc2, V2)) {
                 data.emplace_back(V1, V2);
-            }
-            catch (const std::invalid_argument&) {
-                data.push_back(invalidValue<std::complex<double>>());
+            } else {
+                try {
+                    std::string vstr1 = val.substr(fb + 1, nc - fb - 1);
+                    stringOps::trimString(vstr1);
+                    std::string vstr2 = val.substr(nc + 1, nc2 - nc - 1);
+                    stringOps::trimString(vstr2);
+                    V1 = numConv<double>(vstr1);
+                    V2 = numConv<double>(vstr2);
+                    data.emplace_back(V1, V2);
+                }
+                catch (const std::invalid_argument&) {
+                    data.push_back(invalidValue<std::complex<double>>());
+                }
             }
             fb = nc;
         }
@@ -595,8 +804,11 @@ data_block typeConvert(data_type type, double val)
 {
     switch (type) {
         case data_type::helics_double:
-        default:
-            return ValueConverter<double>::convert(val);
+        default: {
+            char buffer[detail::doubleEncodingSize];
+            detail::encodeDirect(val, buffer);
+            return data_block(buffer, detail::doubleEncodingSize);
+        }
         case data_type::helics_int:
             return ValueConverter<int64_t>::convert(static_cast<int64_t>(val));
         case data_type::helics_complex:
@@ -604,7 +816,7 @@ data_block typeConvert(data_type type, double val)
         case data_type::helics_bool:
             return (val != 0.0) ? "1" : "0";
         case data_type::helics_string:
-            return std::to_string(val);
+            return helicsDoubleString(val);
         case data_type::helics_named_point:
             return ValueConverter<NamedPoint>::convert(NamedPoint{"value", val});
         case data_type::helics_complex_vector: {
@@ -297,6 +297,8 @@ HELICS_CXX_EXPORT const std::string& typeNameStringRef(data_type type);
 /** convert a string to a type*/
 HELICS_CXX_EXPORT data_type getTypeFromString(const std::string& typeName);
 
+/** generate the shortest string representation of a double that converts back to the same value*/
+HELICS_CXX_EXPORT std::string helicsDoubleString(double val);
 /** generate a string representation of a complex number from separate real and imaginary parts*/
 HELICS_CXX_EXPORT std::string helicsComplexString(double real, double imag);
 /** generate a string representation of a complex number */
@@ -13,6 +13,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/fmt_format.h"
 #include "../common/fmt_ostream.h"
 #include "../common/loggerCore.hpp"
+#include "../core/core-exceptions.hpp"
 #include "../core/helicsCLI11.hpp"
 #include "PrecHelper.hpp"
 #include "gmlc/utilities/base64.h"
@@ -32,6 +33,23 @@ SPDX-License-Identifier: BSD-3-Clause
 
 namespace helics {
 namespace apps {
+    static bool isJsonFile(const std::string& filename)
+    {
+        auto lastP = filename.find_last_of('.');
+        auto ext = (lastP != std::string::npos) ? filename.substr(lastP) : std::string{};
+        return (ext == ".json") || (ext == ".JSON");
+    }
+
+    /** streaming output is line oriented so it can only be written in the text format*/
+    static void checkStreamingFile(const std::string& filename)
+    {
+        if (isJsonFile(filename)) {
+            throw(InvalidParameter(fmt::format(
+                "streaming output is only available in the text format, {} is a json file",
+                filename)));
+        }
+    }
+
     Recorder::Recorder(const std::string& appName, FederateInfo& fi): App(appName, fi)
     {
         fed->setFlagOption(helics_flag_observer);
@@ -275,6 +293,11 @@ namespace apps {
         if (!points.empty()) {
             outFile << "#time \ttag\t value\t type*\n";
         }
+        writeTextData(outFile, true);
+    }
+
+    void Recorder::writeTextData(std::ostream& outFile, bool messageHeader)
+    {
         for (auto& v : points) {
             if (v.first) {
                 outFile << static_cast<double>(v.time) << "\t\t"
@@ -290,7 +313,7 @@ namespace apps {
                 }
             }
         }
-        if (!messages.empty()) {
+        if (!messages.empty() && messageHeader) {
             outFile << "# m\t time \tsource\t dest\t message\n";
         }
         for (auto& m : messages) {
@@ -308,9 +331,53 @@ namespace apps {
         }
     }
 
+    void Recorder::openStream()
+    {
+        if (streamFile.is_open()) {
+            return;
+        }
+        checkStreamingFile(outFileName);
+        streamFile.open(outFileName, std::ios::out | std::ios::trunc);
+        if (!streamFile) {
+            throw(std::runtime_error(
+                fmt::format("unable to open {} for streaming the recorded data", outFileName)));
+        }
+        streamFile << "#time \ttag\t value\t type*\n";
+        streamFile << "# m\t time \tsource\t dest\t message\n";
+        streamFile.flush();
+        nextStreamFlush = (streamFlushPeriod > timeZero) ? streamFlushPeriod : Time::maxVal();
+    }
+
+    void Recorder::flushStream(Time currentTime, bool force)
+    {
+        auto buffered = static_cast<int>(points.size() + messages.size());
+        if (!force && buffered < streamBufferSize && currentTime < nextStreamFlush) {
+            return;
+        }
+        if (!streamFile.is_open()) {
+            openStream();
+        }
+        if (buffered > 0) {
+            writeTextData(streamFile, false);
+            streamFile.flush();
+            streamedPoints += points.size();
+            streamedMessages += messages.size();
+            points.clear();
+            messages.clear();
+        }
+        if (streamFlushPeriod > timeZero) {
+            while (nextStreamFlush <= currentTime) {
+                nextStreamFlush += streamFlushPeriod;
+            }
+        }
+    }
+
     void Recorder::initialize()
     {
         generateInterfaces();
+        if (streaming) {
+            openStream();
+        }
 
         vStat.resize(subids.size());
         for (auto& val : subkeys) {
@@ -428,6 +495,9 @@ namespace apps {
                 messages.push_back(cloneEndpoint->getMessage());
             }
         }
+        if (streaming) {
+            flushStream(currentTime, false);
+        }
     }
 
     std::string Recorder::encode(const std::string& str2encode)
@@ -554,6 +624,11 @@ namespace apps {
 
     std::pair<std::string, std::string> Recorder::getValue(int index) const
     {
+        if ((index >= 0) && (index < static_cast<int>(streamedPoints))) {
+            throw(InvalidParameter(
+                fmt::format("point {} has already been streamed to {}", index, outFileName)));
+        }
+        index -= static_cast<int>(streamedPoints);
         if (isValidIndex(index, points)) {
             return {subscriptions[points[index].index].getTarget(), points[index].value};
         }
@@ -562,18 +637,51 @@ namespace apps {
 
     std::unique_ptr<Message> Recorder::getMessage(int index) const
     {
+        if ((index >= 0) && (index < static_cast<int>(streamedMessages))) {
+            throw(InvalidParameter(
+                fmt::format("message {} has already been streamed to {}", index, outFileName)));
+        }
+        index -= static_cast<int>(streamedMessages);
         if (isValidIndex(index, messages)) {
             return std::make_unique<Message>(*messages[index]);
         }
         return nullptr;
     }
 
+    void Recorder::setStreaming(const std::string& filename, int maxBuffered, Time flushPeriod)
+    {
+        if (streamFile.is_open()) {
+            throw(std::runtime_error("streaming output is already active"));
+        }
+        checkStreamingFile(filename);
+        streaming = true;
+        outFileName = filename;
+        streamBufferSize = maxBuffered;
+        streamFlushPeriod = flushPeriod;
+    }
+
     /** save the data to a file*/
     void Recorder::saveFile(const std::string& filename)
     {
-        auto lastP = filename.find_last_of('.');
-        auto ext = (lastP != std::string::npos) ? filename.substr(lastP) : std::string{};
-        if ((ext == ".json") || (ext == ".JSON")) {
+        if (streaming) {
+            if (streamFile.is_open()) {
+                flushStream(Time::maxVal(), true);
+            }
+            if (filename == outFileName) {
+                return;
+            }
+            // the recorded data only exists in the streaming output file
+            checkStreamingFile(filename);
+            std::ifstream streamed(outFileName, std::ios::binary);
+            std::ofstream copy(filename, std::ios::binary | std::ios::trunc);
+            if (!streamed || !copy) {
+                throw(InvalidParameter(fmt::format(
+                    "unable to copy the streamed data from {} to {}", outFileName, filename)));
+            }
+            copy << streamed.rdbuf();
+            return;
+        }
+        if (isJsonFile(filename)) {
             writeJsonFile(filename);
         } else {
             writeTextFile(filename);
@@ -599,6 +707,28 @@ namespace apps {
             "write progress to a map file for concurrent progress monitoring");
 
         app->add_option("--output,-o", outFileName, "the output file for recording the data", true);
+        auto stream_group = app->add_option_group(
+            "streaming", "Options related to writing the data to the output file during the run");
+        stream_group
+            ->add_flag(
+                "--streaming",
+                streaming,
+                "write the captured data to the output file in the text format as it is recorded instead of at the end")
+            ->ignore_underscore();
+        stream_group
+            ->add_option(
+                "--buffer_size",
+                streamBufferSize,
+                "the number of captured points and messages to hold in memory before writing them to the output file",
+                true)
+            ->ignore_underscore()
+            ->check(CLI::PositiveNumber);
+        stream_group
+            ->add_option(
+                "--flush_period",
+                streamFlushPeriod,
+                "the maximum simulation time between writes to the output file in streaming mode")
+            ->ignore_underscore();
 
         auto clone_group = app->add_option_group(
             "cloning", "Options related to endpoint cloning operations and specifications");
@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../application_api/Subscriptions.hpp"
 #include "helicsApp.hpp"
 
+#include <fstream>
 #include <map>
 #include <memory>
 #include <set>
@@ -76,20 +77,40 @@ namespace apps {
     @param captureDesc describes a federate to capture all the interfaces for
     */
         void addCapture(const std::string& captureDesc);
-        /** save the data to a file*/
+        /** save the data to a file
+    @details in streaming mode the data has already been written to the output file so this
+    writes any data still buffered and copies the output file if a different text file is given
+    @throw InvalidParameter if streaming and the file is a json file
+    */
         void saveFile(const std::string& filename);
-        /** get the number of captured points*/
-        auto pointCount() const { return points.size(); }
-        /** get the number of captured messages*/
-        auto messageCount() const { return messages.size(); }
+        /** stream the captured data to a file as it is recorded instead of holding it all in memory
+    @details the file is written in the text format and is readable at any point of the run
+    @param filename the file to write the data to
+    @param maxBuffered the number of captured points and messages to hold before writing them out
+    @param flushPeriod the maximum simulation time between writes to the file, timeZero to write
+    only when the buffer is full
+    @throw InvalidParameter if the file is a json file
+    */
+        void setStreaming(
+            const std::string& filename,
+            int maxBuffered = defaultStreamBuffer,
+            Time flushPeriod = timeZero);
+        /** get the number of captured points including points already streamed to the file*/
+        auto pointCount() const { return points.size() + streamedPoints; }
+        /** get the number of captured messages including messages already streamed to the file*/
+        auto messageCount() const { return messages.size() + streamedMessages; }
         /** get a string with the value of point index
+    @details points already streamed to the output file are no longer available
     @param index the number of the point to retrieve
     @return a pair with the tag as the first element and the value as the second
+    @throw InvalidParameter if the point has already been streamed to the output file
     */
         std::pair<std::string, std::string> getValue(int index) const;
         /** get a message
-    @details makes a copy of a message and returns it in a unique_ptr
+    @details makes a copy of a message and returns it in a unique_ptr, messages already streamed to
+    the output file are no longer available
     @param index the number of the message to retrieve
+    @throw InvalidParameter if the message has already been streamed to the output file
     */
         std::unique_ptr<Message> getMessage(int index) const;
 
@@ -104,6 +125,15 @@ namespace apps {
         void writeJsonFile(const std::string& filename);
         /** helper function to write the date to a text file*/
         void writeTextFile(const std::string& filename);
+        /** write the buffered points and messages in the text format
+        @param messageHeader set to true to write a comment line before the messages*/
+        void writeTextData(std::ostream& outFile, bool messageHeader);
+        /** open the streaming output file and write the header*/
+        void openStream();
+        /** write the buffered data to the streaming output file if the buffer is full or the flush
+        period has elapsed
+        @param force set to true to write the data regardless of the buffer state*/
+        void flushStream(Time currentTime, bool force);
 
         virtual void initialize() override;
         void generateInterfaces();
@@ -159,6 +189,14 @@ namespace apps {
         std::vector<std::string> captureInterfaces; //!< storage for the interfaces to capture
         std::string mapfile; //!< file name for the on-line file updater
         std::string outFileName{"out.txt"}; //!< the final output file
+        static constexpr int defaultStreamBuffer{10000}; //!< the default streaming buffer size
+        bool streaming{false}; //!< write the data to the output file as it is captured
+        int streamBufferSize{defaultStreamBuffer}; //!< the number of captures held before writing
+        Time streamFlushPeriod{timeZero}; //!< the maximum simulation time between writes
+        Time nextStreamFlush{Time::maxVal()}; //!< the time of the next periodic write
+        std::ofstream streamFile; //!< the output file for streaming mode
+        std::size_t streamedPoints{0}; //!< the number of points already written to the file
+        std::size_t streamedMessages{0}; //!< the number of messages already written to the file
     };
 
 } // namespace apps
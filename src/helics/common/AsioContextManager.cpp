@@ -18,6 +18,8 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "AsioContextManager.h"
 
+#include "ThreadPlacement.hpp"
+
 #include <chrono>
 #include <iostream>
 #include <map>
@@ -226,6 +228,7 @@ void AsioContextManager::haltContextLoop()
 
 void contextProcessingLoop(std::shared_ptr<AsioContextManager> ptr)
 {
+    helics::setCurrentThreadName("helics_asio");
     while ((ptr->runCounter > 0) && (!(ptr->terminateLoop))) {
         auto clk = std::chrono::steady_clock::now();
         try {
@@ -0,0 +1,223 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "ThreadPlacement.hpp"
+
+#include "JsonProcessingFunctions.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#    include <pthread.h>
+#    include <sched.h>
+#elif defined(__APPLE__)
+#    include <pthread.h>
+#elif defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#endif
+
+namespace helics {
+/** the largest processor index accepted in a placement*/
+static constexpr int maxProcessorIndex{4095};
+
+static int parseProcessorIndex(const std::string& str)
+{
+    if (str.empty() ||
+        !std::all_of(str.begin(), str.end(), [](char c) { return std::isdigit(c) != 0; })) {
+        throw(std::invalid_argument("invalid processor index \"" + str + "\""));
+    }
+    if (str.size() > 4 || std::stoi(str) > maxProcessorIndex) {
+        throw(std::invalid_argument("processor index " + str + " is out of range"));
+    }
+    return std::stoi(str);
+}
+
+/** parse a processor list like 0-3,8,10-11*/
+static std::vector<int> parseProcessorList(const std::string& list)
+{
+    std::vector<int> cpus;
+    std::string::size_type start{0};
+    while (start <= list.size()) {
+        auto end = list.find(',', start);
+        if (end == std::string::npos) {
+            end = list.size();
+        }
+        auto item = list.substr(start, end - start);
+        item.erase(
+            std::remove_if(item.begin(), item.end(), [](char c) { return std::isspace(c) != 0; }),
+            item.end());
+        if (!item.empty()) {
+            auto dash = item.find('-');
+            if (dash == std::string::npos) {
+                cpus.push_back(parseProcessorIndex(item));
+            } else {
+                auto first = parseProcessorIndex(item.substr(0, dash));
+                auto last = parseProcessorIndex(item.substr(dash + 1));
+                if (last < first) {
+                    throw(std::invalid_argument("invalid processor range \"" + item + "\""));
+                }
+                for (int cpu = first; cpu <= last; ++cpu) {
+                    cpus.push_back(cpu);
+                }
+            }
+        }
+        start = end + 1;
+    }
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
+ThreadPlacement parseThreadPlacement(const std::string& placement)
+{
+    ThreadPlacement result;
+    if (placement.compare(0, 5, "node:") == 0) {
+        result.numaNode = parseProcessorIndex(placement.substr(5));
+        return result;
+    }
+    result.cpus = parseProcessorList(placement);
+    if (result.cpus.empty() && !placement.empty()) {
+        throw(std::invalid_argument("no processors specified in \"" + placement + "\""));
+    }
+    return result;
+}
+
+std::vector<int> getNumaNodeCpus(int node)
+{
+#ifdef __linux__
+    std::ifstream cpulist(
+        "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    if (cpulist && std::getline(cpulist, list)) {
+        try {
+            return parseProcessorList(list);
+        }
+        catch (const std::invalid_argument&) {
+        }
+    }
+#else
+    (void)node;
+#endif
+    return {};
+}
+
+void setCurrentThreadName(const std::string& name)
+{
+#ifdef __linux__
+    // linux limits thread names to 15 characters plus the terminator
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#elif defined(__APPLE__)
+    pthread_setname_np(name.substr(0, 63).c_str());
+#else
+    (void)name;
+#endif
+}
+
+/** get the processors the calling thread is allowed to run on*/
+static std::vector<int> currentThreadCpus()
+{
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+/** restrict the calling thread to a set of processors
+@return true if successful*/
+static bool setCurrentThreadCpus(const std::vector<int>& cpus)
+{
+    if (cpus.empty()) {
+        return false;
+    }
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    return (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0);
+#elif defined(_WIN32)
+    DWORD_PTR mask{0};
+    for (auto cpu : cpus) {
+        if (cpu < static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+            mask |= (static_cast<DWORD_PTR>(1) << cpu);
+        }
+    }
+    return (mask != 0) && (SetThreadAffinityMask(GetCurrentThread(), mask) != 0);
+#else
+    // the platform does not support restricting threads to processors
+    return false;
+#endif
+}
+
+ThreadPlacementInfo placeCurrentThread(
+    const std::string& role,
+    const std::string& name,
+    const ThreadPlacement& placement)
+{
+    ThreadPlacementInfo info;
+    info.role = role;
+    info.name = name;
+    info.numaNode = placement.numaNode;
+    setCurrentThreadName(name);
+    if (!placement.empty()) {
+        // an explicit processor list takes precedence over the numa node
+        info.applied = setCurrentThreadCpus(
+            (!placement.cpus.empty()) ? placement.cpus : getNumaNodeCpus(placement.numaNode));
+    }
+    info.cpus = currentThreadCpus();
+#ifdef __linux__
+    info.cpu = sched_getcpu();
+#endif
+    return info;
+}
+
+std::string generateThreadPlacementJson(
+    const std::string& name,
+    const std::vector<ThreadPlacementInfo>& threads)
+{
+    Json::Value base;
+    base["name"] = name;
+    base["threads"] = Json::arrayValue;
+    for (const auto& thread : threads) {
+        Json::Value tinfo;
+        tinfo["role"] = thread.role;
+        tinfo["name"] = thread.name;
+        tinfo["cpus"] = Json::arrayValue;
+        for (auto cpu : thread.cpus) {
+            tinfo["cpus"].append(cpu);
+        }
+        tinfo["cpu"] = thread.cpu;
+        if (thread.numaNode >= 0) {
+            tinfo["numa_node"] = thread.numaNode;
+        }
+        tinfo["applied"] = thread.applied;
+        base["threads"].append(std::move(tinfo));
+    }
+    return generateJsonString(base);
+}
+
+} // namespace helics
@@ -0,0 +1,61 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace helics {
+/** description of the processors a thread is allowed to run on*/
+struct ThreadPlacement {
+    std::vector<int> cpus; //!< the processors the thread may run on, empty for no restriction
+    int numaNode{-1}; //!< the numa node whose processors the thread may run on, -1 for none
+    /** check if the placement places any restriction on the thread*/
+    bool empty() const { return cpus.empty() && numaNode < 0; }
+};
+
+/** the resulting placement of a running thread*/
+struct ThreadPlacementInfo {
+    std::string role; //!< the role of the thread in the object
+    std::string name; //!< the name of the thread visible to the operating system
+    std::vector<int> cpus; //!< the processors the thread is allowed to run on
+    int cpu{-1}; //!< the processor the thread was running on when it was placed, -1 if unknown
+    int numaNode{-1}; //!< the numa node requested for the thread, -1 for none
+    bool applied{false}; //!< true if a requested placement was applied successfully
+};
+
+/** parse a thread placement description
+@param placement a list of processors and processor ranges like "0-3,8" or a numa node as "node:1"
+@throw std::invalid_argument if the description is not valid
+*/
+ThreadPlacement parseThreadPlacement(const std::string& placement);
+
+/** get the processors belonging to a numa node
+@return the processor list, empty if the node does not exist or the platform does not expose it*/
+std::vector<int> getNumaNodeCpus(int node);
+
+/** name the calling thread and restrict it to the processors of a placement
+@param role the role of the thread recorded in the result
+@param name the name to give the thread,  truncated to 15 characters where the platform requires
+@param placement the processors to restrict the thread to
+@return information about the resulting placement of the thread*/
+ThreadPlacementInfo placeCurrentThread(
+    const std::string& role,
+    const std::string& name,
+    const ThreadPlacement& placement);
+
+/** set the name of the calling thread visible in operating system tools like top and debuggers*/
+void setCurrentThreadName(const std::string& name);
+
+/** generate a json string describing the placement of a set of threads
+@param name the name of the object owning the threads
+@param threads the placement information of each thread*/
+std::string generateThreadPlacementJson(
+    const std::string& name,
+    const std::vector<ThreadPlacementInfo>& threads);
+
+} // namespace helics
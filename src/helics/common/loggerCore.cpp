@@ -18,6 +18,8 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "loggerCore.hpp"
 
+#include "ThreadPlacement.hpp"
+
 #include <iostream>
 #include <string>
 #include <tuple>
@@ -111,6 +113,7 @@ void LoggingCore::processingLoop()
 {
     int index;
     std::string msg;
+    setCurrentThreadName("helics_logger");
     while (true) {
         std::tie(index, msg) = loggingQueue.pop();
 
@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "flagOperations.hpp"
 
 #include <algorithm>
+#include <array>
 #include <complex>
 #include <cstring>
 #include <utility>
@@ -33,29 +34,32 @@ ActionMessage::ActionMessage(
 ActionMessage::ActionMessage(ActionMessage&& act) noexcept:
     messageAction(act.messageAction), messageID(act.messageID), source_id(act.source_id),
     source_handle(act.source_handle), dest_id(act.dest_id), dest_handle(act.dest_handle),
-    counter(act.counter), flags(act.flags), actionTime(act.actionTime),
-    payload(std::move(act.payload)), name(payload), Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso),
-    stringData(std::move(act.stringData))
+    counter(act.counter), flags(act.flags), sequenceID(act.sequenceID),
+    actionTime(act.actionTime), payload(std::move(act.payload)), name(payload), Te(act.Te),
+    Tdemin(act.Tdemin), Tso(act.Tso), stringData(std::move(act.stringData)),
+    sharedPayload(std::move(act.sharedPayload))
 {
 }
 
 ActionMessage::ActionMessage(const ActionMessage& act):
     messageAction(act.messageAction), messageID(act.messageID), source_id(act.source_id),
     source_handle(act.source_handle), dest_id(act.dest_id), dest_handle(act.dest_handle),
-    counter(act.counter), flags(act.flags), actionTime(act.actionTime), payload(act.payload),
-    name(payload), Te(act.Te), Tdemin(act.Tdemin), Tso(act.Tso), stringData(act.stringData)
-
+    counter(act.counter), flags(act.flags), sequenceID(act.sequenceID),
+    actionTime(act.actionTime), payload(act.payload), name(payload), Te(act.Te),
+    Tdemin(act.Tdemin), Tso(act.Tso), stringData(act.stringData),
+    sharedPayload(act.sharedPayload)
 {
 }
 
 ActionMessage::ActionMessage(std::unique_ptr<Message> message):
     messageAction(CMD_SEND_MESSAGE), messageID(message->messageID), actionTime(message->time),
-    payload(std::move(message->data.m_data)), name(payload),
-    stringData({std::move(message->dest),
-                std::move(message->source),
-                std::move(message->original_source),
-                std::move(message->original_dest)})
+    payload(std::move(message->data.m_data)), name(payload)
 {
+    stringData.resize(4);
+    stringData[targetStringLoc] = std::move(message->dest);
+    stringData[sourceStringLoc] = std::move(message->source);
+    stringData[origSourceStringLoc] = std::move(message->original_source);
+    stringData[origDestStringLoc] = std::move(message->original_dest);
 }
 
 ActionMessage::ActionMessage(const std::string& bytes): ActionMessage()
@@ -85,12 +89,14 @@ ActionMessage& ActionMessage::operator=(const ActionMessage& act)
     dest_handle = act.dest_handle;
     counter = act.counter;
     flags = act.flags;
+    sequenceID = act.sequenceID;
     actionTime = act.actionTime;
     Te = act.Te;
     Tdemin = act.Tdemin;
     Tso = act.Tso;
     payload = act.payload;
     stringData = act.stringData;
+    sharedPayload = act.sharedPayload;
     return *this;
 }
 
@@ -104,12 +110,14 @@ ActionMessage& ActionMessage::operator=(ActionMessage&& act) noexcept
     dest_handle = act.dest_handle;
     counter = act.counter;
     flags = act.flags;
+    sequenceID = act.sequenceID;
     actionTime = act.actionTime;
     Te = act.Te;
     Tdemin = act.Tdemin;
     Tso = act.Tso;
     payload = std::move(act.payload);
     stringData = std::move(act.stringData);
+    sharedPayload = std::move(act.sharedPayload);
     return *this;
 }
 
@@ -119,10 +127,11 @@ void ActionMessage::moveInfo(std::unique_ptr<Message> message)
     messageID = message->messageID;
     payload = std::move(message->data.m_data);
     actionTime = message->time;
-    stringData = {std::move(message->dest),
-                  std::move(message->source),
-                  std::move(message->original_source),
-                  std::move(message->original_dest)};
+    stringData.resize(4);
+    stringData[targetStringLoc] = std::move(message->dest);
+    stringData[sourceStringLoc] = std::move(message->source);
+    stringData[origSourceStringLoc] = std::move(message->original_source);
+    stringData[origDestStringLoc] = std::move(message->original_dest);
 }
 
 void ActionMessage::setAction(action_message_def::action_t newAction)
@@ -151,6 +160,16 @@ void ActionMessage::setString(int index, const std::string& str)
     }
 }
 
+/** the largest payload that can be represented in the standard encoding*/
+static constexpr std::size_t maxStandardPayloadSize{0x00FFFFFF};
+/** the largest number of strings that can be represented in the standard encoding*/
+static constexpr std::size_t maxStandardStringCount{255};
+
+bool ActionMessage::requiresCompactEncoding() const
+{
+    return (payloadSize() > maxStandardPayloadSize) || (stringData.size() > maxStandardStringCount);
+}
+
 /** check for little endian*/
 static inline std::uint8_t isLittleEndian()
 {
@@ -165,12 +184,17 @@ int ActionMessage::toByteArray(char* data, int buffer_size) const
     if ((data == nullptr) || (buffer_size == 0)) {
         return -1;
     }
+    if (requiresCompactEncoding()) {
+        // the standard encoding cannot represent this message
+        return toCompactByteArray(data, buffer_size);
+    }
     if (static_cast<int>(buffer_size) < serializedByteCount()) {
         return -1;
     }
     char* dataStart = data;
+    const char* payloadData = (sharedPayload) ? sharedPayload->data() : payload.data();
     // put the main string size in the first 4 bytes;
-    auto ssize = static_cast<uint32_t>(payload.size()) & 0x00FFFFFFu;
+    auto ssize = static_cast<uint32_t>(payloadSize()) & 0x00FFFFFFu;
     *data = littleEndian;
     data[1] = static_cast<uint8_t>(ssize >> 16U);
     data[2] = static_cast<uint8_t>((ssize >> 8U) & 0xFFU);
@@ -210,7 +234,7 @@ int ActionMessage::toByteArray(char* data, int buffer_size) const
         data += sizeof(Time::baseType);
     }
     if (ssize > 0) {
-        std::memcpy(data, payload.data(), ssize);
+        std::memcpy(data, payloadData, ssize);
         data += ssize;
     }
 
@@ -239,8 +263,11 @@ static constexpr int action_message_base_size = static_cast<int>(
 
 int ActionMessage::serializedByteCount() const
 {
+    if (requiresCompactEncoding()) {
+        return compactByteCount();
+    }
     int size{action_message_base_size};
-    size += static_cast<int>(payload.size());
+    size += static_cast<int>(payloadSize());
     // for time request add an additional 3*8 bytes
     if (messageAction == CMD_TIME_REQUEST) {
         size += static_cast<int>(3 * sizeof(Time::baseType));
@@ -265,8 +292,14 @@ std::string ActionMessage::to_string() const
 }
 
 constexpr auto LEADING_CHAR = '\xF3';
+// leading character for packets too large for a 3 byte length
+constexpr auto LEADING_CHAR_LARGE = '\xF4';
 constexpr auto TAIL_CHAR1 = '\xFA';
 constexpr auto TAIL_CHAR2 = '\xFC';
+// first byte of the compact encoding, the standard encoding starts with 0 or 1 for the endianness
+constexpr auto COMPACT_CHAR = '\xC5';
+constexpr std::size_t packetHeaderSize{sizeof(uint32_t)};
+constexpr std::size_t largePacketHeaderSize{sizeof(uint32_t) + 1};
 
 std::string ActionMessage::packetize() const
 {
@@ -278,15 +311,30 @@ std::string ActionMessage::packetize() const
 void ActionMessage::packetize(std::string& data) const
 {
     auto sz = serializedByteCount();
-    data.resize(sizeof(uint32_t) + static_cast<size_t>(sz));
-    toByteArray(&(data[4]), sz);
+    auto header = (static_cast<std::size_t>(sz) + packetHeaderSize > maxStandardPayloadSize) ?
+        largePacketHeaderSize :
+        packetHeaderSize;
+    data.resize(header + static_cast<size_t>(sz));
+    toByteArray(&(data[header]), sz);
+    packetizeData(data, header);
+}
 
-    data[0] = LEADING_CHAR;
+void ActionMessage::packetizeData(std::string& data, std::size_t headerSize)
+{
     // now generate a length header
     auto dsz = static_cast<uint32_t>(data.size());
-    data[1] = static_cast<char>(((dsz >> 16U) & 0xFFU));
-    data[2] = static_cast<char>(((dsz >> 8U) & 0xFFU));
-    data[3] = static_cast<char>(dsz & 0xFFu);
+    if (headerSize == largePacketHeaderSize) {
+        data[0] = LEADING_CHAR_LARGE;
+        data[1] = static_cast<char>(((dsz >> 24U) & 0xFFU));
+        data[2] = static_cast<char>(((dsz >> 16U) & 0xFFU));
+        data[3] = static_cast<char>(((dsz >> 8U) & 0xFFU));
+        data[4] = static_cast<char>(dsz & 0xFFu);
+    } else {
+        data[0] = LEADING_CHAR;
+        data[1] = static_cast<char>(((dsz >> 16U) & 0xFFU));
+        data[2] = static_cast<char>(((dsz >> 8U) & 0xFFU));
+        data[3] = static_cast<char>(dsz & 0xFFu);
+    }
     data.push_back(TAIL_CHAR1);
     data.push_back(TAIL_CHAR2);
 }
@@ -314,6 +362,409 @@ void ActionMessage::to_string(std::string& data) const
     toByteArray(&(data[0]), sz);
 }
 
+namespace {
+    /** the fields of the compact encoding that are only included if they are not the default value*/
+    enum compact_field : std::uint8_t {
+        compact_message_id = 0,
+        compact_source_id = 1,
+        compact_source_handle = 2,
+        compact_dest_id = 3,
+        compact_dest_handle = 4,
+        compact_counter = 5,
+        compact_flags = 6,
+        compact_sequence_id = 7,
+        compact_action_time = 8,
+        compact_action_time_max = 9,
+        compact_te = 10,
+        compact_tdemin = 11,
+        compact_tso = 12,
+        compact_payload = 13,
+        compact_strings = 14,
+        compact_te_max = 15,
+        compact_tdemin_max = 16,
+        compact_tso_max = 17,
+    };
+
+    inline std::uint64_t zigzag(std::int64_t val)
+    {
+        return (static_cast<std::uint64_t>(val) << 1U) ^ static_cast<std::uint64_t>(val >> 63);
+    }
+
+    inline std::int64_t unzigzag(std::uint64_t val)
+    {
+        return static_cast<std::int64_t>(val >> 1U) ^ -static_cast<std::int64_t>(val & 1U);
+    }
+
+    inline int varintSize(std::uint64_t val)
+    {
+        int size{1};
+        while (val >= 0x80U) {
+            val >>= 7U;
+            ++size;
+        }
+        return size;
+    }
+
+    inline char* writeVarint(char* data, std::uint64_t val)
+    {
+        while (val >= 0x80U) {
+            *data = static_cast<char>((val & 0x7FU) | 0x80U);
+            ++data;
+            val >>= 7U;
+        }
+        *data = static_cast<char>(val);
+        return data + 1;
+    }
+
+    /** read a varint
+    @return a pointer to the next byte or nullptr if the data ended before the varint*/
+    inline const char* readVarint(const char* data, const char* end, std::uint64_t& val)
+    {
+        // most fields are small and fit in a single byte
+        if (data < end && static_cast<std::uint8_t>(*data) < 0x80U) {
+            val = static_cast<std::uint8_t>(*data);
+            return data + 1;
+        }
+        val = 0;
+        unsigned int shift{0};
+        while (data < end && shift < 64U) {
+            auto byte = static_cast<std::uint8_t>(*data);
+            ++data;
+            val |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+            if ((byte & 0x80U) == 0) {
+                return data;
+            }
+            shift += 7U;
+        }
+        return nullptr;
+    }
+
+    /** the difference between two times as the bits of an unsigned number so the arithmetic wraps*/
+    inline std::int64_t timeDelta(Time time, Time base)
+    {
+        return static_cast<std::int64_t>(
+            static_cast<std::uint64_t>(time.getBaseTimeCode()) -
+            static_cast<std::uint64_t>(base.getBaseTimeCode()));
+    }
+
+    /** the variable header fields of the compact encoding*/
+    class compactHeader {
+      public:
+        compactHeader(const ActionMessage& cmd, bool hasStrings)
+        {
+            if (cmd.messageID != 0) {
+                add(compact_message_id, zigzag(cmd.messageID));
+            }
+            if (cmd.source_id != parent_broker_id) {
+                add(compact_source_id, zigzag(cmd.source_id.baseValue()));
+            }
+            if (cmd.source_handle != interface_handle{}) {
+                add(compact_source_handle, zigzag(cmd.source_handle.baseValue()));
+            }
+            if (cmd.dest_id != parent_broker_id) {
+                add(compact_dest_id, zigzag(cmd.dest_id.baseValue()));
+            }
+            if (cmd.dest_handle != interface_handle{}) {
+                add(compact_dest_handle, zigzag(cmd.dest_handle.baseValue()));
+            }
+            if (cmd.counter != 0) {
+                add(compact_counter, cmd.counter);
+            }
+            if (cmd.flags != 0) {
+                add(compact_flags, cmd.flags);
+            }
+            if (cmd.sequenceID != 0) {
+                add(compact_sequence_id, cmd.sequenceID);
+            }
+            if (cmd.actionTime == Time::maxVal()) {
+                mask |= (1ULL << compact_action_time_max);
+            } else if (cmd.actionTime != timeZero) {
+                add(compact_action_time, zigzag(cmd.actionTime.getBaseTimeCode()));
+            }
+            if (cmd.action() == CMD_TIME_REQUEST) {
+                // the times are usually equal or close to the action time so encode the difference
+                addTime(compact_te, compact_te_max, cmd.Te, cmd.actionTime);
+                addTime(compact_tdemin, compact_tdemin_max, cmd.Tdemin, cmd.actionTime);
+                addTime(compact_tso, compact_tso_max, cmd.Tso, cmd.actionTime);
+            }
+            // the payload and strings follow the header fields
+            if (cmd.payloadSize() > 0) {
+                mask |= (1ULL << compact_payload);
+            }
+            if (hasStrings) {
+                mask |= (1ULL << compact_strings);
+            }
+        }
+        /** the number of bytes used by the action, the field mask, and the fields*/
+        int size(std::uint64_t action) const
+        {
+            int sz = varintSize(action) + varintSize(mask);
+            for (int ii = 0; ii < count; ++ii) {
+                sz += varintSize(values[ii]);
+            }
+            return sz;
+        }
+        char* write(char* data, std::uint64_t action) const
+        {
+            data = writeVarint(data, action);
+            data = writeVarint(data, mask);
+            for (int ii = 0; ii < count; ++ii) {
+                data = writeVarint(data, values[ii]);
+            }
+            return data;
+        }
+      private:
+        std::uint64_t mask{0}; //!< bit mask of the fields that are present
+        void add(compact_field field, std::uint64_t value)
+        {
+            mask |= (1ULL << field);
+            values[count++] = value;
+        }
+        void addTime(compact_field field, compact_field maxField, Time time, Time base)
+        {
+            if (time == base) {
+                return;
+            }
+            if (time == Time::maxVal()) {
+                mask |= (1ULL << maxField);
+            } else {
+                add(field, zigzag(timeDelta(time, base)));
+            }
+        }
+        // only the first count values are used so the array is not initialized
+        std::array<std::uint64_t, 12> values; //!< the encoded values of the fields  // NOLINT
+        int count{0}; //!< the number of values
+    };
+
+    /** the total size of the compact encoding of a message*/
+    int compactSize(const ActionMessage& cmd, const compactHeader& header)
+    {
+        const auto& strings = cmd.getStringData();
+        auto psize = cmd.payloadSize();
+        int size = 1 + header.size(zigzag(static_cast<std::int64_t>(cmd.action())));
+        if (psize > 0) {
+            size += varintSize(psize) + static_cast<int>(psize);
+        }
+        if (!strings.empty()) {
+            size += varintSize(strings.size());
+            for (auto& str : strings) {
+                size += varintSize(str.size()) + static_cast<int>(str.size());
+            }
+        }
+        return size;
+    }
+
+    /** write the compact encoding of a message,  the buffer must be large enough to hold it
+    @return the number of bytes written*/
+    int writeCompact(const ActionMessage& cmd, const compactHeader& header, char* data)
+    {
+        const auto& strings = cmd.getStringData();
+        char* dataStart = data;
+        *data = COMPACT_CHAR;
+        ++data;
+        data = header.write(data, zigzag(static_cast<std::int64_t>(cmd.action())));
+        auto psize = cmd.payloadSize();
+        if (psize > 0) {
+            const auto& shared = cmd.getSharedPayload();
+            data = writeVarint(data, psize);
+            std::memcpy(data, (shared) ? shared->data() : cmd.payload.data(), psize);
+            data += psize;
+        }
+        if (!strings.empty()) {
+            data = writeVarint(data, strings.size());
+            for (auto& str : strings) {
+                data = writeVarint(data, str.size());
+                std::memcpy(data, str.data(), str.size());
+                data += str.size();
+            }
+        }
+        return static_cast<int>(data - dataStart);
+    }
+} // namespace
+
+int ActionMessage::compactByteCount() const
+{
+    return compactSize(*this, compactHeader(*this, !stringData.empty()));
+}
+
+int ActionMessage::toCompactByteArray(char* data, int buffer_size) const
+{
+    if ((data == nullptr) || (buffer_size == 0)) {
+        return -1;
+    }
+    compactHeader header(*this, !stringData.empty());
+    if (buffer_size < compactSize(*this, header)) {
+        return -1;
+    }
+    return writeCompact(*this, header, data);
+}
+
+std::string ActionMessage::to_compact_string() const
+{
+    std::string data;
+    to_compact_string(data);
+    return data;
+}
+
+void ActionMessage::to_compact_string(std::string& data) const
+{
+    compactHeader header(*this, !stringData.empty());
+    data.resize(compactSize(*this, header));
+    writeCompact(*this, header, &(data[0]));
+}
+
+std::string ActionMessage::packetize_compact() const
+{
+    std::string data;
+    packetize_compact(data);
+    return data;
+}
+
+void ActionMessage::packetize_compact(std::string& data) const
+{
+    compactHeader cheader(*this, !stringData.empty());
+    auto sz = compactSize(*this, cheader);
+    auto header = (static_cast<std::size_t>(sz) + packetHeaderSize > maxStandardPayloadSize) ?
+        largePacketHeaderSize :
+        packetHeaderSize;
+    data.resize(header + static_cast<size_t>(sz));
+    writeCompact(*this, cheader, &(data[header]));
+    packetizeData(data, header);
+}
+
+int ActionMessage::fromCompactByteArray(const char* data, int buffer_size)
+{
+    const char* start = data;
+    const char* end = data + buffer_size;
+    auto fail = [this]() {
+        messageAction = CMD_INVALID;
+        return 0;
+    };
+    ++data;
+    std::uint64_t val{0};
+    std::uint64_t mask{0};
+    data = readVarint(data, end, val);
+    if (data == nullptr) {
+        return fail();
+    }
+    messageAction = static_cast<action_message_def::action_t>(unzigzag(val));
+    data = readVarint(data, end, mask);
+    if (data == nullptr) {
+        return fail();
+    }
+    // read the next field if it is present
+    auto readField = [&data, end, mask, &val](compact_field field) {
+        val = 0;
+        if ((mask & (1ULL << field)) == 0) {
+            return true;
+        }
+        data = readVarint(data, end, val);
+        return data != nullptr;
+    };
+    if (!readField(compact_message_id)) {
+        return fail();
+    }
+    messageID = static_cast<int32_t>(unzigzag(val));
+    if (!readField(compact_source_id)) {
+        return fail();
+    }
+    source_id = ((mask & (1ULL << compact_source_id)) != 0) ?
+        global_federate_id(static_cast<int32_t>(unzigzag(val))) :
+        global_federate_id(parent_broker_id);
+    if (!readField(compact_source_handle)) {
+        return fail();
+    }
+    source_handle = ((mask & (1ULL << compact_source_handle)) != 0) ?
+        interface_handle(static_cast<int32_t>(unzigzag(val))) :
+        interface_handle{};
+    if (!readField(compact_dest_id)) {
+        return fail();
+    }
+    dest_id = ((mask & (1ULL << compact_dest_id)) != 0) ?
+        global_federate_id(static_cast<int32_t>(unzigzag(val))) :
+        global_federate_id(parent_broker_id);
+    if (!readField(compact_dest_handle)) {
+        return fail();
+    }
+    dest_handle = ((mask & (1ULL << compact_dest_handle)) != 0) ?
+        interface_handle(static_cast<int32_t>(unzigzag(val))) :
+        interface_handle{};
+    if (!readField(compact_counter)) {
+        return fail();
+    }
+    counter = static_cast<uint16_t>(val);
+    if (!readField(compact_flags)) {
+        return fail();
+    }
+    flags = static_cast<uint16_t>(val);
+    if (!readField(compact_sequence_id)) {
+        return fail();
+    }
+    sequenceID = static_cast<uint32_t>(val);
+    if ((mask & (1ULL << compact_action_time_max)) != 0) {
+        actionTime = Time::maxVal();
+    } else {
+        if (!readField(compact_action_time)) {
+            return fail();
+        }
+        actionTime.setBaseTimeCode(unzigzag(val));
+    }
+    if (messageAction == CMD_TIME_REQUEST) {
+        auto readTime = [&](compact_field field, compact_field maxField, Time& time) {
+            if ((mask & (1ULL << maxField)) != 0) {
+                time = Time::maxVal();
+                return true;
+            }
+            if (!readField(field)) {
+                return false;
+            }
+            time.setBaseTimeCode(static_cast<Time::baseType>(
+                static_cast<std::uint64_t>(actionTime.getBaseTimeCode()) +
+                static_cast<std::uint64_t>(unzigzag(val))));
+            return true;
+        };
+        if (!readTime(compact_te, compact_te_max, Te) ||
+            !readTime(compact_tdemin, compact_tdemin_max, Tdemin) ||
+            !readTime(compact_tso, compact_tso_max, Tso)) {
+            return fail();
+        }
+    } else {
+        Te = timeZero;
+        Tdemin = timeZero;
+        Tso = timeZero;
+    }
+    sharedPayload.reset();
+    if (!readField(compact_payload)) {
+        return fail();
+    }
+    if (val > static_cast<std::uint64_t>(end - data)) {
+        return fail();
+    }
+    payload.assign(data, static_cast<std::size_t>(val));
+    data += val;
+    if (!readField(compact_strings)) {
+        return fail();
+    }
+    if (val > static_cast<std::uint64_t>(end - data)) {
+        return fail();
+    }
+    auto stringCount = static_cast<std::size_t>(val);
+    if (stringCount > 0) {
+        stringData.resize(stringCount);
+        for (auto& str : stringData) {
+            data = readVarint(data, end, val);
+            if (data == nullptr || val > static_cast<std::uint64_t>(end - data)) {
+                return fail();
+            }
+            str.assign(data, static_cast<std::size_t>(val));
+            data += val;
+        }
+    } else {
+        stringData.clear();
+    }
+    return static_cast<int>(data - start);
+}
+
 template<std::size_t DataSize>
 inline void swap_bytes(std::uint8_t* data)
 {
@@ -326,11 +777,22 @@ int ActionMessage::fromByteArray(const char* data, int buffer_size)
 {
     int tsize{action_message_base_size};
     static const uint8_t littleEndian = isLittleEndian();
+    if (buffer_size > 0 && data[0] == COMPACT_CHAR) {
+        return fromCompactByteArray(data, buffer_size);
+    }
     if (buffer_size < tsize) {
+        // packetized compact messages can be smaller than a standard message, depacketize checks
+        // the frame length for either header size
+        if (buffer_size > 0 && (data[0] == LEADING_CHAR || data[0] == LEADING_CHAR_LARGE)) {
+            auto res = depacketize(data, buffer_size);
+            if (res > 0) {
+                return res;
+            }
+        }
         messageAction = CMD_INVALID;
         return (0);
     }
-    if (data[0] == LEADING_CHAR) {
+    if (data[0] == LEADING_CHAR || data[0] == LEADING_CHAR_LARGE) {
         auto res = depacketize(data, buffer_size);
         if (res > 0) {
             return static_cast<int>(res);
@@ -401,11 +863,12 @@ int ActionMessage::fromByteArray(const char* data, int buffer_size)
         Tdemin = timeZero;
         Tso = timeZero;
     }
+    sharedPayload.reset();
     if (sz > 0) {
         payload.assign(data, sz);
         data += sz;
     }
-    int stringCount = *data;
+    int stringCount = static_cast<uint8_t>(*data);
     ++data;
     if (stringCount != 0) {
         stringData.resize(stringCount);
@@ -462,18 +925,21 @@ int ActionMessage::fromByteArray(const char* data, int buffer_size)
 
 int ActionMessage::depacketize(const char* data, int buffer_size)
 {
-    if (data[0] != LEADING_CHAR) {
+    if (data[0] != LEADING_CHAR && data[0] != LEADING_CHAR_LARGE) {
         return 0;
     }
-    if (buffer_size < 6) {
+    auto header =
+        static_cast<int>((data[0] == LEADING_CHAR) ? packetHeaderSize : largePacketHeaderSize);
+    if (buffer_size < header + 2) {
         return 0;
     }
-    unsigned int message_size = static_cast<unsigned char>(data[1]);
-    message_size <<= 8u;
-    message_size += static_cast<unsigned char>(data[2]);
-    message_size <<= 8u;
-    message_size += static_cast<unsigned char>(data[3]);
-    if (buffer_size < static_cast<int>(message_size + 2)) {
+    unsigned int message_size{0};
+    for (int ii = 1; ii < header; ++ii) {
+        message_size <<= 8u;
+        message_size += static_cast<unsigned char>(data[ii]);
+    }
+    if (message_size < static_cast<unsigned int>(header) ||
+        static_cast<unsigned int>(buffer_size) < message_size + 2) {
         return 0;
     }
     if (data[message_size] != TAIL_CHAR1) {
@@ -483,8 +949,8 @@ int ActionMessage::depacketize(const char* data, int buffer_size)
         return 0;
     }
 
-    int bytesUsed = fromByteArray(data + 4, message_size - 4);
-    return (bytesUsed > 0) ? message_size + 2 : 0;
+    int bytesUsed = fromByteArray(data + header, message_size - header);
+    return (bytesUsed > 0) ? static_cast<int>(message_size + 2) : 0;
 }
 
 void ActionMessage::from_string(const std::string& data)
@@ -560,6 +1026,20 @@ std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd)
     return msg;
 }
 
+MessageView createMessageView(ActionMessage& cmd)
+{
+    if (cmd.stringData.size() < 4) {
+        cmd.stringData.resize(4);
+    }
+    return {cmd.actionTime,
+            cmd.messageID,
+            cmd.payload,
+            cmd.stringData[targetStringLoc],
+            cmd.stringData[origDestStringLoc],
+            cmd.stringData[sourceStringLoc],
+            cmd.stringData[origSourceStringLoc]};
+}
+
 static constexpr char unknownStr[] = "unknown";
 
 // done in this screwy way because this can be called after things have started to be deconstructed so static
@@ -655,6 +1135,8 @@ static constexpr std::pair<action_message_def::action_t, const char*> actionStri
     {action_message_def::action_t::cmd_remove_named_filter, "remove_named_filter"},
     {action_message_def::action_t::cmd_close_interface, "close_interface"},
     {action_message_def::action_t::cmd_multi_message, "multi message"},
+    {action_message_def::action_t::cmd_multi_registration, "multi registration"},
+    {action_message_def::action_t::cmd_multi_pub, "multi publication"},
     // protocol messages are meant for the communication standard and are not used in the Cores/Brokers
     {action_message_def::action_t::cmd_protocol_priority, "protocol_priority"},
     {action_message_def::action_t::cmd_protocol, "protocol"},
@@ -742,7 +1224,7 @@ std::string prettyPrintString(const ActionMessage& command)
                 "From ({}) handle({}) size {} at {} to {}",
                 command.source_id.baseValue(),
                 command.dest_handle.baseValue(),
-                command.payload.size(),
+                command.payloadSize(),
                 static_cast<double>(command.actionTime),
                 command.dest_id.baseValue()));
             break;
@@ -807,6 +1289,42 @@ int appendMessage(ActionMessage& m, const ActionMessage& newMessage)
     return (-1);
 }
 
+ActionMessage unpackMessage(ActionMessage& m, int index)
+{
+    ActionMessage msg;
+    msg.from_string(m.getString(index));
+    if (m.payloadSize() > 0) {
+        if (!m.getSharedPayload()) {
+            m.setSharedPayload(std::make_shared<const data_block>(std::move(m.payload)));
+            m.payload.clear();
+        }
+        msg.payload.clear();
+        msg.setSharedPayload(m.getSharedPayload());
+    }
+    return msg;
+}
+
+std::vector<ActionMessage> packMessages(
+    const std::vector<ActionMessage>& messages,
+    action_message_def::action_t action,
+    std::size_t maxSize)
+{
+    std::vector<ActionMessage> packages;
+    std::size_t packedSize{0};
+    for (const auto& msg : messages) {
+        auto str = msg.to_string();
+        if (packages.empty() || packages.back().counter >= 255 ||
+            (packedSize > 0 && packedSize + str.size() > maxSize)) {
+            packages.emplace_back(action);
+            packedSize = 0;
+        }
+        auto& package = packages.back();
+        packedSize += str.size();
+        package.setString(package.counter++, str);
+    }
+    return packages;
+}
+
 void setIterationFlags(ActionMessage& command, iteration_request iterate)
 {
     switch (iterate) {
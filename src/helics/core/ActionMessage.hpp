@@ -40,14 +40,18 @@ class ActionMessage {
     uint16_t flags{0}; //!<  28 set of messageFlags
     uint32_t sequenceID{0}; //!< a sequence number for ordering
     Time actionTime{timeZero}; //!< 40 the time an action took place or will take place	//32
-    std::string
-        payload; //!< string containing the data	//96 std::string is 32 bytes on most platforms (except libc++)
+    /// string containing the data, for a message with a shared payload use payloadSize() and the
+    /// shared payload instead	//96 std::string is 32 bytes on most platforms (except libc++)
+    std::string payload;
     std::string& name; //!< alias payload to a name reference for registration functions
     Time Te{timeZero}; //!< 48 event time
     Time Tdemin{timeZero}; //!< 56 min dependent event time
     Time Tso{timeZero}; //!< 64 the second order dependent time
   private:
     std::vector<std::string> stringData; //!< container for extra string data
+    /// process local payload shared between recipients, serialized in place of the payload
+    std::shared_ptr<const data_block> sharedPayload;
+
   public:
     /** default constructor*/
     ActionMessage() noexcept: name(payload) {}
@@ -101,6 +105,17 @@ class ActionMessage {
         dest_id = hand.fed_id;
         dest_handle = hand.handle;
     }
+    /** attach a shared immutable payload to the message
+    @details used for local delivery of large values so the same buffer can be given to multiple
+    recipients, if the message is serialized the shared payload is written as the payload*/
+    void setSharedPayload(std::shared_ptr<const data_block> data) { sharedPayload = std::move(data); }
+    /** get the shared payload, the pointer is empty if the message does not have a shared payload*/
+    const std::shared_ptr<const data_block>& getSharedPayload() const { return sharedPayload; }
+    /** get the size of the payload data including a shared payload*/
+    std::size_t payloadSize() const
+    {
+        return (sharedPayload) ? sharedPayload->size() : payload.size();
+    }
     /** get the reference to the string data vector*/
     const std::vector<std::string>& getStringData() const { return stringData; }
 
@@ -140,6 +155,10 @@ class ActionMessage {
         stringData[2] = string3;
         stringData[3] = string4;
     }
+    /** replace the string data with a set of strings
+    @details unlike setString the number of strings is not limited,  messages with more than 255
+    strings are only used inside a core*/
+    void setStringData(std::vector<std::string>&& strings) { stringData = std::move(strings); }
     const std::string& getString(int index) const;
 
     void setString(int index, const std::string& str);
@@ -162,7 +181,13 @@ class ActionMessage {
 
     /** generate a size of the message in bytes if it were to be serialized*/
     int serializedByteCount() const;
+    /** check if the message cannot be represented in the standard encoding
+    @details the standard encoding is limited to a 24 bit payload size and 255 strings*/
+    bool requiresCompactEncoding() const;
     /** convert a command to a raw data bytes
+    @details messages that cannot be represented in the standard encoding
+    /ref requiresCompactEncoding are written with the compact encoding, callers that must use the
+    standard encoding should check first
     @param[out] data pointer to memory to store the command
     @param buffer_size  the size of the buffer
     @return the size of the buffer actually used
@@ -176,6 +201,23 @@ class ActionMessage {
      */
     std::string packetize() const;
     void packetize(std::string& data) const;
+    /** generate the size of the message in bytes if it were serialized with the compact encoding*/
+    int compactByteCount() const;
+    /** convert a command to raw data bytes using the compact encoding
+    @details the compact encoding uses variable length integers, omits fields that have their default values,
+    and has no limit on the payload size.  It is recognized automatically by fromByteArray
+    @param[out] data pointer to memory to store the command
+    @param buffer_size  the size of the buffer
+    @return the size of the buffer actually used
+    */
+    int toCompactByteArray(char* data, int buffer_size) const;
+    /** convert to a string using the compact encoding*/
+    void to_compact_string(std::string& data) const;
+    /** convert to a byte string using the compact encoding*/
+    std::string to_compact_string() const;
+    /** packetize the message using the compact encoding*/
+    std::string packetize_compact() const;
+    void packetize_compact(std::string& data) const;
     /** covert to a byte vector using a reference*/
     void to_vector(std::vector<char>& data) const;
     /** convert a command to a byte vector*/
@@ -193,6 +235,13 @@ class ActionMessage {
 
     friend std::unique_ptr<Message> createMessageFromCommand(const ActionMessage& cmd);
     friend std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd);
+    friend MessageView createMessageView(ActionMessage& cmd);
+
+  private:
+    /** load a command from the compact encoding*/
+    int fromCompactByteArray(const char* data, int buffer_size);
+    /** add the packet header and tail to serialized data that starts after the header*/
+    static void packetizeData(std::string& data, std::size_t headerSize);
 };
 
 inline bool operator<(const ActionMessage& cmd, const ActionMessage& cmd2)
@@ -210,6 +259,11 @@ std::unique_ptr<Message> createMessageFromCommand(const ActionMessage& cmd);
  */
 std::unique_ptr<Message> createMessageFromCommand(ActionMessage&& cmd);
 
+/** create a view of the message fields of an ActionMessage so it can be filtered in place
+@details the view references the data in the command and is only valid while the command is
+unchanged*/
+MessageView createMessageView(ActionMessage& cmd);
+
 /** check if a command is a protocol command*/
 inline bool isProtocolCommand(const ActionMessage& command) noexcept
 {
@@ -323,6 +377,25 @@ std::ostream& operator<<(std::ostream& os, const ActionMessage& command);
 @return the integer location of the message in the stringData section*/
 int appendMessage(ActionMessage& m, const ActionMessage& newMessage);
 
+/** extract a message from a multi message container
+@details if the container has a payload it is the payload of every message in the container,  the
+first call converts it to a shared payload so the messages all refer to a single buffer
+@param m the multi message container
+@param index the location of the message in the stringData section
+@return the extracted message*/
+ActionMessage unpackMessage(ActionMessage& m, int index);
+
+/** pack a sequence of messages into multi message containers
+@param messages the messages to pack
+@param action the action of the containers (CMD_MULTI_MESSAGE or CMD_MULTI_REGISTRATION)
+@param maxSize the maximum number of bytes of packed messages in a single container,  a message
+larger than that is placed in a container by itself
+@return the containers,  each holding at most 255 messages*/
+std::vector<ActionMessage> packMessages(
+    const std::vector<ActionMessage>& messages,
+    action_message_def::action_t action,
+    std::size_t maxSize);
+
 /** generate a string representing an error from an ActionMessage
 @param command the command to generate the error string for
 @return a string describing the error, if the string is not an error the string is empty
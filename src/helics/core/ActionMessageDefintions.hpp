@@ -160,6 +160,10 @@ across different compilers*/
 
         cmd_close_interface = 133, //!< cmd to close all communications from an interface
         cmd_multi_message = 1037, //!< cmd that encapsulates a bunch of messages in its payload
+        /** cmd that packs interface registrations and named links into its string data*/
+        cmd_multi_registration = 1038,
+        /** cmd that packs the values published by a federate in a batch into its string data*/
+        cmd_multi_pub = 1039,
 
         cmd_connection_error = 2034, //!< cmd indicating a connection error with a broker/federate
 
@@ -310,6 +314,8 @@ across different compilers*/
 #define CMD_SET_GLOBAL action_message_def::action_t::cmd_set_global
 
 #define CMD_MULTI_MESSAGE action_message_def::action_t::cmd_multi_message
+#define CMD_MULTI_REGISTRATION action_message_def::action_t::cmd_multi_registration
+#define CMD_MULTI_PUB action_message_def::action_t::cmd_multi_pub
 
 // definitions for the protocol options
 #define PROTOCOL_PING 10
@@ -0,0 +1,51 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "ActionMessageQueue.hpp"
+
+namespace helics {
+void ActionMessageQueue::setQueueType(queue_type newType)
+{
+    auto oldType = type.exchange(newType);
+    if (oldType == newType) {
+        return;
+    }
+    // transfer anything already queued so no messages are lost in the switch
+    if (oldType == queue_type::lockfree) {
+        auto msg = lockFreeQueue.try_pop();
+        while (msg) {
+            if (isPriorityCommand(*msg)) {
+                blockingQueue.emplacePriority(std::move(*msg));
+            } else {
+                blockingQueue.emplace(std::move(*msg));
+            }
+            msg = lockFreeQueue.try_pop();
+        }
+    } else {
+        auto msg = blockingQueue.try_pop();
+        while (msg) {
+            if (isPriorityCommand(*msg)) {
+                lockFreeQueue.pushPriority(std::move(*msg));
+            } else {
+                lockFreeQueue.push(std::move(*msg));
+            }
+            msg = blockingQueue.try_pop();
+        }
+    }
+}
+
+void ActionMessageQueue::popBatch(std::vector<ActionMessage>& batch)
+{
+    batch.push_back(pop());
+    auto msg = try_pop();
+    while (msg) {
+        batch.push_back(std::move(*msg));
+        msg = try_pop();
+    }
+}
+
+} // namespace helics
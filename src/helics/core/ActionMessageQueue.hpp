@@ -0,0 +1,111 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "ActionMessage.hpp"
+#include "MpscPriorityQueue.hpp"
+#include "gmlc/containers/BlockingPriorityQueue.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace helics {
+/** the primary routing queue of a broker or core
+@details the queue can run as a mutex based blocking priority queue (the default) or as a lock free multiple
+producer single consumer queue, which avoids contention when many federate threads feed the same core
+*/
+class ActionMessageQueue {
+  public:
+    /** the implementations of the queue*/
+    enum class queue_type : std::uint8_t {
+        blocking = 0, //!< mutex based blocking priority queue
+        lockfree = 1, //!< lock free multiple producer single consumer queue
+    };
+    ActionMessageQueue() = default;
+    /** set the implementation to use
+    @details this must not be called concurrently with the consumer, producers may still be pushing.
+    Any messages already in the queue are transferred to the new implementation.  A producer in the
+    middle of a push may still add to the previous implementation, the consumer picks those up on
+    its next extraction*/
+    void setQueueType(queue_type newType);
+    /** get the implementation in use*/
+    queue_type getQueueType() const { return type.load(std::memory_order_acquire); }
+
+    /** add a message to the queue*/
+    void push(const ActionMessage& m)
+    {
+        if (getQueueType() == queue_type::lockfree) {
+            lockFreeQueue.push(m);
+        } else {
+            blockingQueue.push(m);
+        }
+    }
+    /** move a message into the queue*/
+    void push(ActionMessage&& m)
+    {
+        if (getQueueType() == queue_type::lockfree) {
+            lockFreeQueue.push(std::move(m));
+        } else {
+            blockingQueue.emplace(std::move(m));
+        }
+    }
+    /** add a message to the priority channel*/
+    void pushPriority(const ActionMessage& m)
+    {
+        if (getQueueType() == queue_type::lockfree) {
+            lockFreeQueue.pushPriority(m);
+        } else {
+            blockingQueue.pushPriority(m);
+        }
+    }
+    /** move a message into the priority channel*/
+    void pushPriority(ActionMessage&& m)
+    {
+        if (getQueueType() == queue_type::lockfree) {
+            lockFreeQueue.pushPriority(std::move(m));
+        } else {
+            blockingQueue.emplacePriority(std::move(m));
+        }
+    }
+    /** extract a message blocking until one is available
+    @details only callable from the consumer thread*/
+    ActionMessage pop()
+    {
+        auto msg = try_pop();
+        if (msg) {
+            return std::move(*msg);
+        }
+        return (getQueueType() == queue_type::lockfree) ? lockFreeQueue.pop() : blockingQueue.pop();
+    }
+    /** extract a message if one is available
+    @details only callable from the consumer thread*/
+    stx::optional<ActionMessage> try_pop()
+    {
+        if (getQueueType() == queue_type::lockfree) {
+            auto msg = lockFreeQueue.try_pop();
+            return (msg) ? msg : blockingQueue.try_pop();
+        }
+        auto msg = blockingQueue.try_pop();
+        return (msg) ? msg : lockFreeQueue.try_pop();
+    }
+    /** extract all the messages currently in the queue
+    @details blocks until at least one message is available
+    @param batch the vector to append the messages to*/
+    void popBatch(std::vector<ActionMessage>& batch);
+    /** check if the queue is empty
+    @details only callable from the consumer thread*/
+    bool empty() const { return lockFreeQueue.empty() && blockingQueue.empty(); }
+
+  private:
+    /** the implementation in use, atomic since producers read it while setQueueType may change it*/
+    std::atomic<queue_type> type{queue_type::blocking};
+    gmlc::containers::BlockingPriorityQueue<ActionMessage> blockingQueue; //!< the mutex based queue
+    MpscPriorityQueue<ActionMessage> lockFreeQueue; //!< the lock free queue
+};
+
+} // namespace helics
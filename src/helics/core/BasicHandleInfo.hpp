@@ -7,6 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include "basic_core_types.hpp"
+#include "StringPool.hpp"
 #include "flagOperations.hpp"
 
 #include <string>
@@ -36,7 +37,12 @@ enum handle_flag_definitions {
 class BasicHandleInfo {
   public:
     /** default constructor*/
-    BasicHandleInfo() noexcept: type_in(type), type_out(units) {}
+    BasicHandleInfo():
+        keyHandle(StringPool::intern(std::string())), typeHandle(keyHandle),
+        unitsHandle(keyHandle), key(*keyHandle), type(*typeHandle), units(*unitsHandle),
+        type_in(type), type_out(units)
+    {
+    }
     /** construct from the data*/
     BasicHandleInfo(
         global_federate_id federate_id,
@@ -46,12 +52,10 @@ class BasicHandleInfo {
         const std::string& type_name,
         const std::string& unit_name):
         handle{federate_id, handle_id},
-        handleType(type_of_handle), key(key_name), type(type_name), units(unit_name), type_in(type),
-        type_out(units)
-
+        handleType(type_of_handle), keyHandle(StringPool::intern(key_name)),
+        typeHandle(StringPool::intern(type_name)), unitsHandle(StringPool::intern(unit_name)),
+        key(*keyHandle), type(*typeHandle), units(*unitsHandle), type_in(type), type_out(units)
     {
-        /* NOTE:: all current cases already have std::string they are passing into the function and most are
-        short,so we are taking by reference to avoid a copy then move  and just have a copy*/
     }
 
     const global_handle handle{}; //!< the global federate id for the creator of the handle
@@ -60,9 +64,15 @@ class BasicHandleInfo {
     bool used{false}; //!< indicator that the handle is being used to link with another federate
     uint16_t flags{0}; //!< flags corresponding to the flags used in ActionMessages +some extra ones
 
-    const std::string key; //!< the name of the handle
-    const std::string type; //!< the type of data used by the handle
-    const std::string units; //!< the units associated with the handle
+  private:
+    const StringPool::handle keyHandle; //!< the pool reference for the key
+    const StringPool::handle typeHandle; //!< the pool reference for the type
+    const StringPool::handle unitsHandle; //!< the pool reference for the units
+
+  public:
+    const std::string& key; //!< the name of the handle (interned)
+    const std::string& type; //!< the type of data used by the handle (interned)
+    const std::string& units; //!< the units associated with the handle (interned)
     std::string interface_info; //!< storage for a user info string
     const std::string& type_in; //!< the input type of a filter
     const std::string& type_out; //!< the output type of a filter
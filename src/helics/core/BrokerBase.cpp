@@ -147,6 +147,68 @@ std::shared_ptr<helicsCLI11App> BrokerBase::generateBaseCLI()
         "--terminate_on_error,--halt_on_error",
         terminate_on_error,
         "specify that a broker should cause the federation to terminate on an error");
+    hApp->add_flag(
+        "--batch_processing",
+        batchProcessing,
+        "process the queued commands in batches, messages for local federates are delivered once per batch");
+    hApp->add_flag(
+        "--coalesce_time_requests",
+        coalesceTimeRequests,
+        "hold the time requests forwarded to dependents until a batch of commands is processed and send only "
+        "the final state, implies --batch_processing");
+    hApp->add_option(
+            "--registration_package_size",
+            registrationPackageSize,
+            "the maximum size in bytes of a packed interface registration message, set to 0 "
+            "to send interface registrations and links individually")
+        ->check(CLI::NonNegativeNumber);
+    hApp->add_flag(
+        "--lock_free_queue,--lockfree_queue",
+        useLockFreeQueue,
+        "use a lock free queue for routing messages, reduces contention when many threads send through "
+        "the same core or broker");
+    auto* thread_group = hApp->add_option_group(
+        "threads",
+        "Options related to the placement of threads, placements are a processor list like "
+        "'0-3,8' or a numa node like 'node:1'");
+    auto placementOption = [thread_group](
+                               const std::string& name,
+                               ThreadPlacement& placement,
+                               const std::string& description) {
+        thread_group->add_option_function<std::string>(
+            name,
+            [&placement](const std::string& val) {
+                try {
+                    placement = parseThreadPlacement(val);
+                }
+                catch (const std::invalid_argument& ia) {
+                    throw CLI::ValidationError(ia.what());
+                }
+            },
+            description);
+    };
+    placementOption(
+        "--affinity,--queue_affinity",
+        queueThreadPlacement,
+        "the processors to run the queue processing thread on");
+    placementOption(
+        "--tx_affinity", txThreadPlacement, "the processors to run the comms transmit thread on");
+    placementOption(
+        "--rx_affinity", rxThreadPlacement, "the processors to run the comms receive thread on");
+    thread_group
+        ->add_option_function<int>(
+            "--numa_node",
+            [this](int node) {
+                for (auto* placement :
+                     {&queueThreadPlacement, &txThreadPlacement, &rxThreadPlacement}) {
+                    if (placement->empty()) {
+                        placement->numaNode = node;
+                    }
+                }
+            },
+            "run all the threads of the broker or core on the processors of a numa node, a "
+            "processor list given for a specific thread takes precedence")
+        ->check(CLI::NonNegativeNumber);
     auto* logging_group =
         hApp->add_option_group("logging", "Options related to file and message logging");
     logging_group->add_flag(
@@ -253,12 +315,20 @@ void BrokerBase::configureBase()
     timeCoord = std::make_unique<ForwardingTimeCoordinator>();
     timeCoord->setMessageSender([this](const ActionMessage& msg) { addActionMessage(msg); });
     timeCoord->restrictive_time_policy = restrictive_time_policy;
+    if (coalesceTimeRequests) {
+        // the held updates are sent at the end of each batch
+        batchProcessing = true;
+        timeCoord->coalesceUpdates = true;
+    }
 
     loggingObj = std::make_unique<Logger>();
     if (!logFile.empty()) {
         loggingObj->openFile(logFile);
     }
     loggingObj->startLogging(maxLogLevel, maxLogLevel);
+    actionQueue.setQueueType(
+        useLockFreeQueue ? ActionMessageQueue::queue_type::lockfree :
+                           ActionMessageQueue::queue_type::blocking);
     mainLoopIsRunning.store(true);
     queueProcessingThread = std::thread(&BrokerBase::queueProcessingLoop, this);
     brokerState = broker_state_t::configured;
@@ -294,6 +364,11 @@ void BrokerBase::generateNewIdentifier()
     identifier = genId();
 }
 
+std::vector<ThreadPlacementInfo> BrokerBase::getThreadPlacement() const
+{
+    return {queueThreadInfo};
+}
+
 void BrokerBase::setErrorState(int eCode, const std::string& estring)
 {
     lastErrorString = estring;
@@ -373,10 +448,10 @@ void BrokerBase::addActionMessage(const ActionMessage& m)
 void BrokerBase::addActionMessage(ActionMessage&& m)
 {
     if (isPriorityCommand(m)) {
-        actionQueue.emplacePriority(std::move(m));
+        actionQueue.pushPriority(std::move(m));
     } else {
         // just route to the general queue;
-        actionQueue.emplace(std::move(m));
+        actionQueue.push(std::move(m));
     }
 }
 #ifndef HELICS_DISABLE_ASIO
@@ -444,6 +519,13 @@ bool BrokerBase::tryReconnect()
     return false;
 }
 
+void BrokerBase::processBatchEnd()
+{
+    if (timeCoord) {
+        timeCoord->flushUpdates();
+    }
+}
+
 //#define DISABLE_TICK
 void BrokerBase::queueProcessingLoop()
 {
@@ -451,6 +533,7 @@ void BrokerBase::queueProcessingLoop()
         mainLoopIsRunning.store(false);
         return;
     }
+    queueThreadInfo = placeCurrentThread("queue", "q:" + identifier, queueThreadPlacement);
     std::vector<ActionMessage> dumpMessages;
 #ifndef HELICS_DISABLE_ASIO
     auto serv = AsioContextManager::getContextPointer();
@@ -501,8 +584,40 @@ void BrokerBase::queueProcessingLoop()
         mainLoopIsRunning.store(false);
         return;
     }
+    std::vector<ActionMessage> batch;
+    std::size_t batchIndex{0};
+    auto nextCommand = [&, this]() -> ActionMessage {
+        if (!batchProcessing) {
+            auto cmd = actionQueue.try_pop();
+            if (cmd) {
+                return std::move(*cmd);
+            }
+            // the queue has drained so send anything held back before waiting for more commands
+            processBatchEnd();
+            return actionQueue.pop();
+        }
+        if (batchIndex >= batch.size()) {
+            if (!batch.empty()) {
+                processBatchEnd();
+                batch.clear();
+                batchIndex = 0;
+            }
+            actionQueue.popBatch(batch);
+        }
+        return std::move(batch[batchIndex++]);
+    };
+    auto logUnprocessed = [&, this](const char* prefix) {
+        for (; batchIndex < batch.size(); ++batchIndex) {
+            if (!isDisconnectCommand(batch[batchIndex])) {
+                LOG_TRACE(
+                    global_broker_id_local,
+                    identifier,
+                    std::string(prefix) + prettyPrintString(batch[batchIndex]));
+            }
+        }
+    };
     while (true) {
-        auto command = actionQueue.pop();
+        auto command = nextCommand();
         ++messageCounter;
         if (dumplog) {
             dumpMessages.push_back(command);
@@ -595,8 +710,12 @@ void BrokerBase::queueProcessingLoop()
                 break;
             case CMD_TERMINATE_IMMEDIATELY:
                 timerStop();
+                if (batchProcessing) {
+                    processBatchEnd();
+                }
                 mainLoopIsRunning.store(false);
                 logDump();
+                logUnprocessed("TI unprocessed command ");
                 {
                     auto tcmd = actionQueue.try_pop();
                     while (tcmd) {
@@ -614,10 +733,14 @@ void BrokerBase::queueProcessingLoop()
                 timerStop();
                 if (!haltOperations) {
                     processCommand(std::move(command));
+                    if (batchProcessing) {
+                        processBatchEnd();
+                    }
                     mainLoopIsRunning.store(false);
                     logDump();
                     processDisconnect();
                 }
+                logUnprocessed("STOPPED unprocessed command ");
                 auto tcmd = actionQueue.try_pop();
                 while (tcmd) {
                     if (!isDisconnectCommand(*tcmd)) {
@@ -646,8 +769,7 @@ action_message_def::action_t BrokerBase::commandProcessor(ActionMessage& command
             return command.action();
         case CMD_MULTI_MESSAGE:
             for (int ii = 0; ii < command.counter; ++ii) {
-                ActionMessage NMess;
-                NMess.from_string(command.getString(ii));
+                auto NMess = unpackMessage(command, ii);
                 auto V = commandProcessor(NMess);
                 if (V != CMD_IGNORE) {
                     // overwrite the abort command but ignore ticks in a multi-message context they shouldn't be there
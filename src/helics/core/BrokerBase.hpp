@@ -11,9 +11,10 @@ virtual base class for object that function like a broker includes common parame
 and some common methods used cores and brokers
 */
 
+#include "../common/ThreadPlacement.hpp"
 #include "ActionMessage.hpp"
+#include "ActionMessageQueue.hpp"
 #include "federate_id_extra.hpp"
-#include "gmlc/containers/BlockingPriorityQueue.hpp"
 
 #include <atomic>
 #include <memory>
@@ -73,12 +74,13 @@ class BrokerBase {
         false}; //!< flag indicating that the message queue should not be used and all functions
     //!< called directly instead of distinct thread
     bool disable_timer{false}; //!< turn off the timer/timeout subsystem completely
+    bool useLockFreeQueue{false}; //!< use the lock free implementation of the action queue
     std::atomic<std::size_t> messageCounter{
         0}; //!< counter for the total number of message processed
   protected:
     std::string logFile; //!< the file to log message to
     std::unique_ptr<ForwardingTimeCoordinator> timeCoord; //!< object managing the time control
-    gmlc::containers::BlockingPriorityQueue<ActionMessage> actionQueue; //!< primary routing queue
+    ActionMessageQueue actionQueue; //!< primary routing queue
     /** enumeration of the possible core states*/
     enum class broker_state_t : int16_t {
         created = -6, //!< the broker has been created
@@ -105,6 +107,19 @@ class BrokerBase {
     bool forwardTick{
         false}; //!< indicator that ticks should be forwarded to the command processor regardless
     bool no_ping{false}; //!< indicator that the broker is not very responsive to ping requests
+    bool batchProcessing{
+        false}; //!< indicator that the queue is drained in batches with processBatchEnd called after each batch
+    bool coalesceTimeRequests{
+        false}; //!< indicator that timing updates are held until the end of a batch and only the final state sent
+    /** the maximum number of bytes of packed messages in a single registration package,  0 to send
+    interface registrations individually,  the default keeps packages below the default
+    interprocess message size*/
+    int32_t registrationPackageSize{3072};
+    ThreadPlacement queueThreadPlacement; //!< processors for the queue processing thread
+    ThreadPlacement txThreadPlacement; //!< processors for the comms transmit thread
+    ThreadPlacement rxThreadPlacement; //!< processors for the comms receive thread
+    /** the resulting placement of the queue processing thread,  only accessed from that thread*/
+    ThreadPlacementInfo queueThreadInfo;
     decltype(std::chrono::steady_clock::now())
         errorTimeStart; //!< time when the error condition started related to the errorDelay
     std::atomic<int> errorCode{0}; //!< storage for last error code
@@ -181,6 +196,11 @@ class BrokerBase {
     @param command the command to process
     */
     virtual void processPriorityCommand(ActionMessage&& command) = 0;
+    /** function called after each batch of commands when operating in batch processing mode and
+    whenever the queue drains otherwise
+    @details the queue will be empty or nearly so when called, it is called before waiting for new commands.
+    The base version sends any timing update held by the time coordinator*/
+    virtual void processBatchEnd();
 
     /** send a Message to the logging system
     @return true if the message was actually logged
@@ -197,6 +217,9 @@ class BrokerBase {
     virtual std::string generateLocalAddressString() const = 0;
     /** generate a CLI11 Application for subprocesses for processing of command line arguments*/
     virtual std::shared_ptr<helicsCLI11App> generateCLI();
+    /** get the placement of the threads operating the broker or core
+    @details only callable from the queue processing thread*/
+    virtual std::vector<ThreadPlacementInfo> getThreadPlacement() const;
     /** set the broker error state and error string*/
     void setErrorState(int eCode, const std::string& estring);
     /** set the logging file if using the default logger*/
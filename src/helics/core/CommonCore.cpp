@@ -25,6 +25,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "coreTypeOperations.hpp"
 #include "fileConnections.hpp"
 #include "gmlc/concurrency/DelayedObjects.hpp"
+#include "helicsCLI11.hpp"
 #include "helics_definitions.hpp"
 #include "loggingHelper.hpp"
 #include "queryHelpers.hpp"
@@ -192,6 +193,8 @@ void CommonCore::processDisconnect(bool skipUnregister)
             addActionMessage(CMD_STOP);
             return;
         }
+        // the shards are stopped before the comms go away so nothing can still be delivering
+        stopShards();
         brokerDisconnect();
     }
     brokerState = broker_state_t::terminated;
@@ -258,9 +261,23 @@ void CommonCore::unregister()
 }
 CommonCore::~CommonCore()
 {
+    stopShards();
     joinAllThreads();
 }
 
+std::shared_ptr<helicsCLI11App> CommonCore::generateCLI()
+{
+    auto app = BrokerBase::generateCLI();
+    app->add_option(
+           "--shards",
+           shardCount,
+           "split the local federates across a number of worker threads that deliver the values "
+           "published between them instead of the main processing loop")
+        ->ignore_underscore()
+        ->check(CLI::NonNegativeNumber);
+    return app;
+}
+
 FederateState* CommonCore::getFederateAt(local_federate_id federateID) const
 {
     /*
@@ -347,8 +364,7 @@ bool CommonCore::isLocal(global_federate_id global_fedid) const
 
 route_id CommonCore::getRoute(global_federate_id global_fedid) const
 {
-    auto fnd = routing_table.find(global_fedid);
-    return (fnd != routing_table.end()) ? fnd->second : parent_route_id;
+    return routing_table.getRoute(global_fedid);
 }
 
 bool CommonCore::isConfigured() const
@@ -417,7 +433,7 @@ void CommonCore::finalize(local_federate_id federateID)
     ActionMessage bye(CMD_DISCONNECT);
     bye.source_id = fed->global_id.load();
     bye.dest_id = bye.source_id;
-    addActionMessage(bye);
+    addFederateMessage(federateID, bye);
     fed->finalize();
 }
 
@@ -1210,6 +1226,9 @@ void CommonCore::addSourceTarget(interface_handle handle, const std::string& tar
     addActionMessage(std::move(cmd));
 }
 
+/// values at least this size are delivered through a single shared buffer instead of copies per subscriber
+static constexpr uint64_t sharedPayloadThreshold{1024};
+
 void CommonCore::setValue(interface_handle handle, const char* data, uint64_t len)
 {
     auto handleInfo = getHandleInfo(handle);
@@ -1236,6 +1255,42 @@ void CommonCore::setValue(interface_handle handle, const char* data, uint64_t le
         if (subs.empty()) {
             return;
         }
+        if (len >= sharedPayloadThreshold) {
+            // large values are copied once into a shared immutable buffer that is passed to all the
+            // subscribers, local subscribers store the same buffer and it is only serialized if the
+            // value has to go to another core
+            auto sharedData = std::make_shared<const data_block>(data, len);
+            ActionMessage mv(CMD_PUB);
+            mv.source_id = handleInfo->getFederateId();
+            mv.source_handle = handle;
+            mv.counter = static_cast<uint16_t>(fed->getCurrentIteration());
+            mv.actionTime = fed->nextAllowedSendTime();
+            if (subs.size() == 1) {
+                mv.setDestination(subs[0]);
+                mv.setSharedPayload(std::move(sharedData));
+                addFederateTraffic(fed->local_id, std::move(mv));
+                return;
+            }
+            // the packed messages only carry the destinations, the package carries the value once
+            // and unpackMessage attaches it to each of them
+            ActionMessage package(CMD_MULTI_MESSAGE);
+            package.source_id = mv.source_id;
+            package.source_handle = handle;
+            package.setSharedPayload(sharedData);
+            for (auto& target : subs) {
+                mv.setDestination(target);
+                if (appendMessage(package, mv) < 0) {
+                    addFederateTraffic(fed->local_id, std::move(package));
+                    package = ActionMessage(CMD_MULTI_MESSAGE);
+                    package.source_id = mv.source_id;
+                    package.source_handle = handle;
+                    package.setSharedPayload(sharedData);
+                    appendMessage(package, mv);
+                }
+            }
+            addFederateTraffic(fed->local_id, std::move(package));
+            return;
+        }
         if (subs.size() == 1) {
             ActionMessage mv(CMD_PUB);
             mv.source_id = handleInfo->getFederateId();
@@ -1245,7 +1300,7 @@ void CommonCore::setValue(interface_handle handle, const char* data, uint64_t le
             mv.payload = std::string(data, len);
             mv.actionTime = fed->nextAllowedSendTime();
 
-            actionQueue.push(std::move(mv));
+            addFederateTraffic(fed->local_id, std::move(mv));
             return;
         } else {
             ActionMessage package(CMD_MULTI_MESSAGE);
@@ -1264,18 +1319,84 @@ void CommonCore::setValue(interface_handle handle, const char* data, uint64_t le
                 auto res = appendMessage(package, mv);
                 if (res < 0) // deal with max package size if there are a lot of subscribers
                 {
-                    actionQueue.push(std::move(package));
+                    addFederateTraffic(fed->local_id, std::move(package));
                     package = ActionMessage(CMD_MULTI_MESSAGE);
                     package.source_id = handleInfo->getFederateId();
                     package.source_handle = handle;
                     appendMessage(package, mv);
                 }
             }
-            actionQueue.push(std::move(package));
+            addFederateTraffic(fed->local_id, std::move(package));
         }
     }
 }
 
+void CommonCore::setValues(
+    const std::vector<interface_handle>& handles,
+    const std::vector<data_block>& values)
+{
+    if (handles.size() != values.size()) {
+        throw(InvalidParameter("the number of values does not match the number of publications"));
+    }
+    if (handles.empty()) {
+        return;
+    }
+    std::vector<const BasicHandleInfo*> handleInfo;
+    handleInfo.reserve(handles.size());
+    for (auto handle : handles) {
+        auto info = getHandleInfo(handle);
+        if (info == nullptr) {
+            throw(InvalidIdentifier("Handle not valid (setValues)"));
+        }
+        if (info->handleType != handle_type::publication) {
+            throw(InvalidIdentifier("handle does not point to a publication or control output"));
+        }
+        if (!handleInfo.empty() && info->local_fed_id != handleInfo.front()->local_fed_id) {
+            throw(InvalidParameter("all the publications must belong to the same federate"));
+        }
+        handleInfo.push_back(info);
+    }
+    auto fed = getFederateAt(handleInfo.front()->local_fed_id);
+    ActionMessage mv(CMD_PUB);
+    mv.source_id = handleInfo.front()->getFederateId();
+    mv.counter = static_cast<uint16_t>(fed->getCurrentIteration());
+    mv.actionTime = fed->nextAllowedSendTime();
+
+    ActionMessage batch(CMD_MULTI_PUB);
+    batch.source_id = mv.source_id;
+    std::vector<std::string> packed;
+    for (std::size_t ii = 0; ii < handles.size(); ++ii) {
+        const auto* info = handleInfo[ii];
+        if (checkActionFlag(*info, disconnected_flag) || !info->used) {
+            continue;
+        }
+        const auto& value = values[ii];
+        if (!fed->checkAndSetValue(handles[ii], value.data(), value.size())) {
+            continue;
+        }
+        auto subs = fed->getSubscribers(handles[ii]);
+        if (subs.empty()) {
+            continue;
+        }
+        mv.source_handle = handles[ii];
+        mv.payload = value.to_string();
+        for (auto& target : subs) {
+            mv.setDestination(target);
+            packed.emplace_back();
+            mv.to_string(packed.back());
+        }
+    }
+    if (packed.empty()) {
+        return;
+    }
+    LOG_DATA_MESSAGES(
+        parent_broker_id,
+        fed->getIdentifier(),
+        fmt::format("setting {} values in a batch", packed.size()));
+    batch.setStringData(std::move(packed));
+    addFederateTraffic(fed->local_id, std::move(batch));
+}
+
 std::shared_ptr<const data_block> CommonCore::getValue(interface_handle handle)
 {
     auto handleInfo = getHandleInfo(handle);
@@ -1625,21 +1746,110 @@ void CommonCore::sendMessage(interface_handle sourceHandle, std::unique_ptr<Mess
     addActionMessage(std::move(m));
 }
 
+const BasicHandleInfo* CommonCore::findLocalDestination(const ActionMessage& message)
+{
+    if (message.dest_id != parent_broker_id) {
+        // the handle is an index into the local handles so check that first before searching
+        auto* hndl = loopHandles.getHandleInfo(message.dest_handle);
+        if (hndl != nullptr && hndl->getFederateId() == message.dest_id) {
+            return hndl;
+        }
+        return loopHandles.findHandle(message.getDest());
+    }
+    const auto& target = message.getString(targetStringLoc);
+    auto index = message.source_handle.baseValue();
+    if (index < 0 || index >= 1'000'000) {
+        return loopHandles.getEndpoint(target);
+    }
+    // endpoints tend to send repeatedly to the same destination so the last destination name is cached
+    if (static_cast<std::size_t>(index) >= endpointDestinationCache.size()) {
+        endpointDestinationCache.resize(static_cast<std::size_t>(index) + 1);
+    }
+    auto& cached = endpointDestinationCache[index];
+    if (cached.second != nullptr && cached.first == target) {
+        return cached.second;
+    }
+    auto* ept = loopHandles.getEndpoint(target);
+    if (ept != nullptr) {
+        cached.first = target;
+        cached.second = ept;
+    }
+    return ept;
+}
+
+/** run a non cloning filter operator on a message
+@details operators that support it modify the message fields in place,  others operate on a
+Message object moved out of the command and back into it afterwards
+@return false if the filter dropped the message*/
+static bool filterMessage(FilterOperator& op, ActionMessage& cmd)
+{
+    if (op.isInPlace()) {
+        auto view = createMessageView(cmd);
+        if (!op.processInPlace(view)) {
+            return false;
+        }
+        cmd.setAction(CMD_SEND_MESSAGE);
+        return true;
+    }
+    auto result = op.process(createMessageFromCommand(std::move(cmd)));
+    if (!result) {
+        return false;
+    }
+    cmd.moveInfo(std::move(result));
+    return true;
+}
+
+/** reset the routing information of a filtered message to that of a newly constructed message*/
+static void clearMessageRouting(ActionMessage& cmd)
+{
+    cmd.source_id = parent_broker_id;
+    cmd.source_handle = interface_handle();
+    cmd.dest_id = parent_broker_id;
+    cmd.dest_handle = interface_handle();
+    cmd.counter = 0;
+    cmd.flags = 0;
+    cmd.sequenceID = 0;
+}
+
+/** generate the copies of a message made by a local cloning filter
+@details operators that support it only generate the destinations and the copies are built
+directly from the command
+@param deliver callable taking each copy as an ActionMessage rvalue*/
+template<class Callable>
+static void cloneMessage(FilterOperator& op, ActionMessage& cmd, Callable&& deliver)
+{
+    if (op.isInPlace()) {
+        std::vector<std::string> destinations;
+        op.getCloneDestinations(createMessageView(cmd), destinations);
+        for (const auto& dest : destinations) {
+            ActionMessage clone(CMD_SEND_MESSAGE);
+            clone.messageID = cmd.messageID;
+            clone.actionTime = cmd.actionTime;
+            clone.payload = cmd.payload;
+            clone.setStringData(
+                dest,
+                cmd.getString(sourceStringLoc),
+                cmd.getString(origSourceStringLoc),
+                cmd.getString(targetStringLoc));
+            deliver(std::move(clone));
+        }
+        return;
+    }
+    for (auto& msg : op.processVector(createMessageFromCommand(cmd))) {
+        if (msg) {
+            deliver(ActionMessage(std::move(msg)));
+        }
+    }
+}
+
 void CommonCore::deliverMessage(ActionMessage& message)
 {
     switch (message.action()) {
         case CMD_SEND_MESSAGE: {
             // Find the destination endpoint
-            auto localP = (message.dest_id == parent_broker_id) ?
-                loopHandles.getEndpoint(message.getString(targetStringLoc)) :
-                loopHandles.findHandle(message.getDest());
+            auto localP = findLocalDestination(message);
             if (localP == nullptr) {
-                auto kfnd = knownExternalEndpoints.find(message.getString(targetStringLoc));
-                if (kfnd != knownExternalEndpoints.end()) { // destination is known
-                    transmit(kfnd->second, message);
-                } else {
-                    transmit(parent_route_id, message);
-                }
+                transmit(parent_route_id, message);
                 return;
             }
             // now we deal with local processing
@@ -1657,7 +1867,7 @@ void CommonCore::deliverMessage(ActionMessage& message)
                                 auto mid = ++messageCounter;
                                 tblock.messageID = mid;
                                 auto fed = getFederateCore(fed_id);
-                                fed->addAction(tblock);
+                                sendToFederate(fed, tblock);
                                 // now send a message to get filtered
                                 message.setAction(CMD_SEND_FOR_DEST_FILTER_AND_RETURN);
                                 message.messageID = mid;
@@ -1670,13 +1880,10 @@ void CommonCore::deliverMessage(ActionMessage& message)
                                 return;
                             }
                             // the filter is part of this core
-                            auto tempMessage = createMessageFromCommand(std::move(message));
-                            if (ffunc->destFilter->filterOp) {
-                                auto nmessage =
-                                    ffunc->destFilter->filterOp->process(std::move(tempMessage));
-                                message.moveInfo(std::move(nmessage));
-                            } else {
-                                message.moveInfo(std::move(tempMessage));
+                            if (ffunc->destFilter->filterOp &&
+                                !filterMessage(*ffunc->destFilter->filterOp, message)) {
+                                // the filter dropped the message
+                                return;
                             }
                         }
                     }
@@ -1690,25 +1897,18 @@ void CommonCore::deliverMessage(ActionMessage& message)
                                 global_handle(global_broker_id_local, clFilter->handle));
                             if (FiltI != nullptr) {
                                 if (FiltI->filterOp != nullptr) {
-                                    // this is a cloning filter so it generates a bunch(?) of new messages
-                                    auto new_messages = FiltI->filterOp->processVector(
-                                        createMessageFromCommand(message));
-                                    for (auto& msg : new_messages) {
-                                        if (msg) {
-                                            if (msg->dest ==
-                                                localP
-                                                    ->key) //in case the clone filter send to itself.
-                                            {
-                                                ActionMessage cmd(std::move(msg));
-                                                cmd.dest_id = localP->handle.fed_id;
-                                                cmd.dest_handle = localP->handle.handle;
-                                                routeMessage(std::move(cmd));
-                                            } else {
-                                                ActionMessage cmd(std::move(msg));
-                                                deliverMessage(cmd);
-                                            }
+                                    // this is a cloning filter so it generates a set of copies
+                                    auto deliverClone = [this, localP](ActionMessage&& cmd) {
+                                        // in case the clone filter sends to itself
+                                        if (cmd.getString(targetStringLoc) == localP->key) {
+                                            cmd.dest_id = localP->handle.fed_id;
+                                            cmd.dest_handle = localP->handle.handle;
+                                            routeMessage(std::move(cmd));
+                                        } else {
+                                            deliverMessage(cmd);
                                         }
-                                    }
+                                    };
+                                    cloneMessage(*FiltI->filterOp, message, deliverClone);
                                 }
                             }
                         } else {
@@ -1730,7 +1930,7 @@ void CommonCore::deliverMessage(ActionMessage& message)
 
             auto fed = getFederateCore(localP->getFederateId());
             if (fed != nullptr) {
-                fed->addAction(std::move(message));
+                sendToFederate(fed, std::move(message));
             }
         } break;
         case CMD_SEND_FOR_FILTER:
@@ -2054,7 +2254,7 @@ std::string CommonCore::quickCoreQueries(const std::string& queryStr) const
 {
     if ((queryStr == "queries") || (queryStr == "available_queries")) {
         return "[isinit;isconnected;name;address;queries;address;federates;inputs;endpoints;filtered_endpoints;"
-               "publications;filters;federate_map;dependency_graph;data_flow_graph;dependencies;dependson;dependents;current_time;global_time;current_state]";
+               "publications;filters;federate_map;dependency_graph;data_flow_graph;dependencies;dependson;dependents;current_time;time_updates;global_time;current_state;placement]";
     }
     if (queryStr == "isconnected") {
         return (isConnected()) ? "true" : "false";
@@ -2228,6 +2428,12 @@ std::string CommonCore::coreQuery(const std::string& queryStr) const
             return "{}";
         }
     }
+    if (queryStr == "time_updates") {
+        return timeCoord->printUpdateCounts();
+    }
+    if (queryStr == "placement") {
+        return generateThreadPlacementJson(getIdentifier(), getThreadPlacement());
+    }
     if (queryStr == "current_state") {
         Json::Value base;
         loadBasicJsonInfo(base, [](Json::Value& val, const FedInfo& fed) {
@@ -2364,6 +2570,24 @@ void CommonCore::setGlobal(const std::string& valueName, const std::string& valu
     addActionMessage(std::move(querycmd));
 }
 
+/** check if a command can be held and packed with other registrations for the parent broker*/
+static bool isPackableRegistration(const ActionMessage& command)
+{
+    switch (command.action()) {
+        case CMD_REG_INPUT:
+        case CMD_REG_PUB:
+        case CMD_REG_ENDPOINT:
+        case CMD_REG_FILTER:
+        case CMD_ADD_NAMED_PUBLICATION:
+        case CMD_ADD_NAMED_INPUT:
+        case CMD_ADD_NAMED_ENDPOINT:
+        case CMD_ADD_NAMED_FILTER:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void CommonCore::processPriorityCommand(ActionMessage&& command)
 {
     // deal with a few types of message immediately
@@ -2374,6 +2598,9 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
             "|| priority_cmd:{} from {}",
             prettyPrintString(command),
             command.source_id.baseValue()));
+    if (!heldRegistrations.empty()) {
+        flushRegistrations();
+    }
     switch (command.action()) {
         case CMD_PING_PRIORITY:
             if (command.dest_id == global_broker_id_local) {
@@ -2475,7 +2702,7 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
                 }
 
                 // push the command to the local queue
-                fed->addAction(std::move(command));
+                sendToFederate(fed, std::move(command));
             }
         } break;
         case CMD_REG_ROUTE:
@@ -2553,7 +2780,7 @@ void CommonCore::processPriorityCommand(ActionMessage&& command)
                     if (repStr == "#wait") {
                         if (fedptr != nullptr) {
                             command.dest_id = fedptr->global_id;
-                            fedptr->addAction(std::move(command));
+                            sendToFederate(fedptr, std::move(command));
                             break;
                         } else {
                             repStr = "#error";
@@ -2629,6 +2856,7 @@ void CommonCore::sendErrorToFederates(int error_code, const std::string& message
     errorCom.source_id = global_broker_id_local;
     errorCom.messageID = error_code;
     errorCom.payload = message;
+    // this can be called from the timeout monitor thread so it cannot use the federate batches
     loopFederates.apply([&errorCom](auto& fed) {
         if ((fed) && (fed.state == operation_state::operating)) {
             fed->addAction(errorCom);
@@ -2670,6 +2898,9 @@ void CommonCore::processCommand(ActionMessage&& command)
         getIdentifier(),
         fmt::format(
             "|| cmd:{} from {}", prettyPrintString(command), command.source_id.baseValue()));
+    if (!heldRegistrations.empty() && !isPackableRegistration(command)) {
+        flushRegistrations();
+    }
     switch (command.action()) {
         case CMD_IGNORE:
             break;
@@ -2750,7 +2981,7 @@ void CommonCore::processCommand(ActionMessage&& command)
             break;
         case CMD_BROADCAST_DISCONNECT: {
             timeCoord->processTimeMessage(command);
-            loopFederates.apply([&command](auto& fed) { fed->addAction(command); });
+            loopFederates.apply([this, &command](auto& fed) { sendToFederate(fed.fed, command); });
             checkAndProcessDisconnect();
         } break;
         case CMD_STOP:
@@ -2846,7 +3077,7 @@ void CommonCore::processCommand(ActionMessage&& command)
                 for (auto fed : loopFederates) {
                     if (fed->getState() != federate_state::HELICS_FINISHED) {
                         bye.dest_id = fed->global_id.load();
-                        fed->addAction(bye);
+                        sendToFederate(fed.fed, bye);
                     }
                 }
                 addActionMessage(CMD_STOP);
@@ -2889,7 +3120,10 @@ void CommonCore::processCommand(ActionMessage&& command)
             processDestFilterReturn(command);
             break;
         case CMD_PUB:
-            routeMessage(command);
+            routeMessage(std::move(command));
+            break;
+        case CMD_MULTI_PUB:
+            routeValueBatch(command);
             break;
         case CMD_LOG:
             if (command.dest_id == global_broker_id_local) {
@@ -3070,7 +3304,8 @@ void CommonCore::processCommand(ActionMessage&& command)
             if (brokerState.compare_exchange_strong(
                     exp, broker_state_t::operating)) { // forward the grant to all federates
                 organizeFilterOperations();
-                loopFederates.apply([&command](auto& fed) { fed->addAction(command); });
+                startShards();
+                loopFederates.apply([this, &command](auto& fed) { sendToFederate(fed.fed, command); });
                 timeCoord->enteringExecMode();
                 auto res = timeCoord->checkExecEntry();
                 if (res == message_processing_result::next_step) {
@@ -3122,7 +3357,7 @@ void CommonCore::registerInterface(ActionMessage& command)
                         ActionMessage add(
                             CMD_ADD_INTERDEPENDENCY, global_broker_id_local, command.source_id);
 
-                        fed->addAction(add);
+                        sendToFederate(fed, add);
                         timeCoord->addDependent(fed->global_id);
                     }
                 }
@@ -3161,7 +3396,7 @@ void CommonCore::registerInterface(ActionMessage& command)
                 return;
         }
         if (!command.name.empty()) {
-            transmit(parent_route_id, std::move(command));
+            transmitRegistration(std::move(command));
         }
     } else if (command.dest_id == global_broker_id_local) {
         if (command.action() == CMD_REG_ENDPOINT) {
@@ -3182,6 +3417,77 @@ void CommonCore::registerInterface(ActionMessage& command)
     }
 }
 
+void CommonCore::transmitRegistration(ActionMessage&& cmd)
+{
+    if ((registrationPackageSize <= 0) ||
+        ((cmd.dest_id != parent_broker_id) && (cmd.dest_id != higher_broker_id))) {
+        routeMessage(std::move(cmd));
+        return;
+    }
+    heldRegistrations.push_back(std::move(cmd));
+    // the held registrations are sent from processBatchEnd once the queue drains, whether or not
+    // the queue is processed in batches
+    if (heldRegistrations.size() >= 255) {
+        flushRegistrations();
+    }
+}
+
+void CommonCore::flushRegistrations()
+{
+    if (heldRegistrations.size() == 1) {
+        transmit(parent_route_id, std::move(heldRegistrations.front()));
+    } else if (!heldRegistrations.empty()) {
+        auto packages = packMessages(
+            heldRegistrations,
+            CMD_MULTI_REGISTRATION,
+            static_cast<std::size_t>(registrationPackageSize));
+        for (auto& package : packages) {
+            package.source_id = global_broker_id_local;
+            transmit(parent_route_id, std::move(package));
+        }
+    }
+    heldRegistrations.clear();
+}
+
+/** values sent to another core are packed in messages no larger than this*/
+static constexpr std::size_t valuePackageSize{16384};
+
+void CommonCore::routeValueBatch(ActionMessage& cmd)
+{
+    std::vector<std::pair<route_id, std::vector<ActionMessage>>> heldValues;
+    for (const auto& str : cmd.getStringData()) {
+        ActionMessage value;
+        value.from_string(str);
+        if (isLocal(value.dest_id) || (value.dest_id == global_broker_id_local)) {
+            routeMessage(std::move(value));
+            continue;
+        }
+        auto route = ((value.dest_id == parent_broker_id) || (value.dest_id == higher_broker_id)) ?
+            parent_route_id :
+            getRoute(value.dest_id);
+        auto held = std::find_if(heldValues.begin(), heldValues.end(), [route](const auto& rt) {
+            return rt.first == route;
+        });
+        if (held == heldValues.end()) {
+            heldValues.emplace_back(route, std::vector<ActionMessage>{});
+            held = heldValues.end() - 1;
+        }
+        held->second.push_back(std::move(value));
+    }
+    for (auto& held : heldValues) {
+        if (held.second.size() == 1) {
+            transmit(held.first, std::move(held.second.front()));
+            continue;
+        }
+        auto packages = packMessages(held.second, CMD_MULTI_MESSAGE, valuePackageSize);
+        for (auto& package : packages) {
+            package.source_id = global_broker_id_local;
+            package.dest_id = held.second.front().dest_id;
+            transmit(held.first, std::move(package));
+        }
+    }
+}
+
 void CommonCore::setAsUsed(BasicHandleInfo* hand)
 {
     assert(hand != nullptr);
@@ -3213,7 +3519,7 @@ void CommonCore::checkForNamedInterface(ActionMessage& command)
                 command.setStringData(pub->type, pub->units);
                 addTargetToInterface(command);
             } else {
-                routeMessage(std::move(command));
+                transmitRegistration(std::move(command));
             }
         } break;
         case CMD_ADD_NAMED_INPUT: {
@@ -3240,7 +3546,7 @@ void CommonCore::checkForNamedInterface(ActionMessage& command)
                 command.name = inputName;
                 addTargetToInterface(command);
             } else {
-                routeMessage(std::move(command));
+                transmitRegistration(std::move(command));
             }
         } break;
         case CMD_ADD_NAMED_FILTER: {
@@ -3261,7 +3567,7 @@ void CommonCore::checkForNamedInterface(ActionMessage& command)
                 }
                 addTargetToInterface(command);
             } else {
-                routeMessage(std::move(command));
+                transmitRegistration(std::move(command));
             }
         } break;
         case CMD_ADD_NAMED_ENDPOINT: {
@@ -3279,7 +3585,7 @@ void CommonCore::checkForNamedInterface(ActionMessage& command)
                 command.swapSourceDest();
                 addTargetToInterface(command);
             } else {
-                routeMessage(std::move(command));
+                transmitRegistration(std::move(command));
             }
         } break;
         default:
@@ -3386,7 +3692,7 @@ void CommonCore::disconnectInterface(ActionMessage& command)
         if (handleInfo->handleType != handle_type::filter) {
             auto fed = getFederateCore(command.source_id);
             if (fed != nullptr) {
-                fed->addAction(command);
+                sendToFederate(fed, command);
             }
         }
     }
@@ -3405,7 +3711,7 @@ void CommonCore::addTargetToInterface(ActionMessage& command)
                 auto fed = getFederateCore(command.dest_id);
                 if (fed != nullptr) {
                     command.setAction(CMD_ADD_DEPENDENT);
-                    fed->addAction(command);
+                    sendToFederate(fed, command);
                 }
             }
         }
@@ -3433,7 +3739,7 @@ void CommonCore::addTargetToInterface(ActionMessage& command)
         auto fed = getFederateCore(command.dest_id);
         if (fed != nullptr) {
             if (!checkActionFlag(command, error_flag)) {
-                fed->addAction(command);
+                sendToFederate(fed, command);
             }
             auto handle = loopHandles.getHandleInfo(command.dest_handle.baseValue());
             if (handle != nullptr) {
@@ -3461,7 +3767,7 @@ void CommonCore::removeTargetFromInterface(ActionMessage& command)
     } else { // just forward these to the appropriate federate
         auto fed = getFederateCore(command.dest_id);
         if (fed != nullptr) {
-            fed->addAction(command);
+            sendToFederate(fed, command);
         }
     }
 }
@@ -3603,7 +3909,7 @@ void CommonCore::checkDependencies()
 
                 rmdep.source_id = global_broker_id_local;
                 rmdep.dest_id = fed->global_id.load();
-                fed->addAction(rmdep);
+                sendToFederate(fed, rmdep);
                 isobs = true;
             } else if (fed->getOptionFlag(defs::flags::source_only)) {
                 timeCoord->removeDependent(fed->global_id);
@@ -3611,7 +3917,7 @@ void CommonCore::checkDependencies()
 
                 rmdep.source_id = global_broker_id_local;
                 rmdep.dest_id = fed->global_id.load();
-                fed->addAction(rmdep);
+                sendToFederate(fed, rmdep);
                 issource = true;
             }
         }
@@ -3849,7 +4155,7 @@ void CommonCore::processCommandsForCore(const ActionMessage& cmd)
                         return;
                     }
                     bye.dest_id = fed->global_id.load();
-                    fed->addAction(bye);
+                    sendToFederate(fed, bye);
                 });
 
                 addActionMessage(CMD_STOP);
@@ -3979,7 +4285,7 @@ void CommonCore::routeMessage(ActionMessage& cmd, global_federate_id dest)
         auto fed = getFederateCore(dest);
         if (fed != nullptr) {
             if (fed->getState() != federate_state::HELICS_FINISHED) {
-                fed->addAction(cmd);
+                sendToFederate(fed, cmd);
             } else {
                 auto rep = fed->processPostTerminationAction(cmd);
                 if (rep) {
@@ -4004,7 +4310,7 @@ void CommonCore::routeMessage(const ActionMessage& cmd)
         if (fed != nullptr) {
             if ((fed->getState() != federate_state::HELICS_FINISHED) &&
                 (fed->getState() != federate_state::HELICS_ERROR)) {
-                fed->addAction(cmd);
+                sendToFederate(fed, cmd);
             } else {
                 auto rep = fed->processPostTerminationAction(cmd);
                 if (rep) {
@@ -4032,7 +4338,7 @@ void CommonCore::routeMessage(ActionMessage&& cmd, global_federate_id dest)
         auto fed = getFederateCore(dest);
         if (fed != nullptr) {
             if (fed->getState() != federate_state::HELICS_FINISHED) {
-                fed->addAction(std::move(cmd));
+                sendToFederate(fed, std::move(cmd));
             } else {
                 auto rep = fed->processPostTerminationAction(cmd);
                 if (rep) {
@@ -4057,7 +4363,7 @@ void CommonCore::routeMessage(ActionMessage&& cmd)
         auto fed = getFederateCore(dest);
         if (fed != nullptr) {
             if (fed->getState() != federate_state::HELICS_FINISHED) {
-                fed->addAction(std::move(cmd));
+                sendToFederate(fed, std::move(cmd));
             } else {
                 auto rep = fed->processPostTerminationAction(cmd);
                 if (rep) {
@@ -4071,6 +4377,179 @@ void CommonCore::routeMessage(ActionMessage&& cmd)
     }
 }
 
+void CommonCore::sendToFederate(FederateState* fed, const ActionMessage& cmd)
+{
+    if (!batchProcessing) {
+        fed->addAction(cmd);
+        return;
+    }
+    sendToFederate(fed, ActionMessage(cmd));
+}
+
+void CommonCore::sendToFederate(FederateState* fed, ActionMessage&& cmd)
+{
+    if (!batchProcessing) {
+        fed->addAction(std::move(cmd));
+        return;
+    }
+    if (cmd.action() == CMD_IGNORE) {
+        return;
+    }
+    auto index = static_cast<std::size_t>(fed->local_id.baseValue());
+    if (index >= federateBatches.size()) {
+        federateBatches.resize(index + 1);
+    }
+    auto& fedBatch = federateBatches[index];
+    if (fedBatch.empty()) {
+        batchedFederates.push_back(fed);
+    }
+    fedBatch.push_back(std::move(cmd));
+}
+
+void CommonCore::processBatchEnd()
+{
+    flushRegistrations();
+    BrokerBase::processBatchEnd();
+    for (auto* fed : batchedFederates) {
+        auto& fedBatch = federateBatches[static_cast<std::size_t>(fed->local_id.baseValue())];
+        fed->addActions(fedBatch);
+        fedBatch.clear();
+    }
+    batchedFederates.clear();
+}
+
+void CommonCore::addFederateMessage(local_federate_id federateID, const ActionMessage& cmd)
+{
+    if (shardsActive.load()) {
+        auto shardList = shards.lock_shared();
+        if (!shardList->empty()) {
+            auto index = static_cast<std::size_t>(federateID.baseValue()) % shardList->size();
+            (*shardList)[index]->queue.push(cmd);
+            return;
+        }
+    }
+    addActionMessage(cmd);
+}
+
+void CommonCore::addFederateTraffic(local_federate_id federateID, ActionMessage&& cmd)
+{
+    if (shardsActive.load()) {
+        auto shardList = shards.lock_shared();
+        if (!shardList->empty()) {
+            auto index = static_cast<std::size_t>(federateID.baseValue()) % shardList->size();
+            (*shardList)[index]->queue.push(std::move(cmd));
+            return;
+        }
+    }
+    actionQueue.push(std::move(cmd));
+}
+
+void CommonCore::startShards()
+{
+    if (shardCount <= 0) {
+        return;
+    }
+    auto shardList = shards.lock();
+    if (!shardList->empty()) {
+        return;
+    }
+    for (int ii = 0; ii < shardCount; ++ii) {
+        shardList->push_back(std::make_unique<FederateShard>());
+    }
+    for (int ii = 0; ii < shardCount; ++ii) {
+        auto& shard = *(*shardList)[ii];
+        shard.worker = std::thread([this, &shard, ii]() { shardProcessingLoop(shard, ii); });
+    }
+    shardsActive.store(true);
+}
+
+void CommonCore::stopShards()
+{
+    // the exclusive lock is held until the shards are drained so nothing published after the stop
+    // can reach the main loop ahead of traffic still in a shard
+    auto shardList = shards.lock();
+    if (shardList->empty()) {
+        return;
+    }
+    shardsActive.store(false);
+    for (auto& shard : *shardList) {
+        shard->queue.push(ActionMessage(CMD_TERMINATE_IMMEDIATELY));
+    }
+    for (auto& shard : *shardList) {
+        if (shard->worker.joinable()) {
+            shard->worker.join();
+        }
+        // anything pushed while the shard was stopping still goes to the main loop
+        auto cmd = shard->queue.try_pop();
+        while (cmd) {
+            addActionMessage(std::move(*cmd));
+            cmd = shard->queue.try_pop();
+        }
+    }
+    shardList->clear();
+}
+
+void CommonCore::shardProcessingLoop(FederateShard& shard, int index)
+{
+    setCurrentThreadName("s" + std::to_string(index) + ":" + getIdentifier());
+    while (true) {
+        auto cmd = shard.queue.pop();
+        if (cmd.action() == CMD_TERMINATE_IMMEDIATELY) {
+            return;
+        }
+        shardDeliver(shard, std::move(cmd));
+    }
+}
+
+void CommonCore::shardDeliver(FederateShard& shard, ActionMessage&& cmd)
+{
+    switch (cmd.action()) {
+        case CMD_MULTI_MESSAGE:
+            for (int ii = 0; ii < cmd.counter; ++ii) {
+                shardDeliver(shard, unpackMessage(cmd, ii));
+            }
+            return;
+        case CMD_PUB: {
+            // values for running local federates skip the main loop,  everything else including
+            // time coordination goes through it after any values published before it
+            auto* fed = getShardTarget(shard, cmd.dest_id);
+            if (fed != nullptr) {
+                auto state = fed->getState();
+                if ((state != federate_state::HELICS_FINISHED) &&
+                    (state != federate_state::HELICS_ERROR)) {
+                    fed->addAction(std::move(cmd));
+                    return;
+                }
+            }
+        } break;
+        default:
+            break;
+    }
+    addActionMessage(std::move(cmd));
+}
+
+FederateState* CommonCore::getShardTarget(FederateShard& shard, global_federate_id federateID)
+{
+    auto fnd = shard.targets.find(federateID);
+    if (fnd != shard.targets.end()) {
+        return fnd->second;
+    }
+    // the shards start after initialization so the set of local federates is fixed
+    FederateState* target{nullptr};
+    {
+        auto feds = federates.lock();
+        for (std::size_t ii = 0; ii < feds->size(); ++ii) {
+            auto* fed = (*feds)[ii];
+            if (fed != nullptr && fed->global_id.load() == federateID) {
+                target = fed;
+                break;
+            }
+        }
+    }
+    shard.targets.emplace(federateID, target);
+    return target;
+}
+
 // Checks for filter operations
 ActionMessage& CommonCore::processMessage(ActionMessage& m)
 {
@@ -4089,21 +4568,14 @@ ActionMessage& CommonCore::processMessage(ActionMessage& m)
                 }
                 if (filt->core_id == global_broker_id_local) {
                     if (filt->cloning) {
-                        // cloning filter returns a vector
-                        auto new_messages =
-                            filt->filterOp->processVector(createMessageFromCommand(m));
-                        for (auto& msg : new_messages) {
-                            if (msg) {
-                                ActionMessage cmd(std::move(msg));
-                                deliverMessage(cmd);
-                            }
-                        }
+                        // cloning filter generates a set of copies
+                        cloneMessage(*filt->filterOp, m, [this](ActionMessage&& cmd) {
+                            deliverMessage(cmd);
+                        });
                     } else {
                         // deal with local source filters
-                        auto tempMessage = createMessageFromCommand(std::move(m));
-                        tempMessage = filt->filterOp->process(std::move(tempMessage));
-                        if (tempMessage) {
-                            m = ActionMessage(std::move(tempMessage));
+                        if (filterMessage(*filt->filterOp, m)) {
+                            clearMessageRouting(m);
                         } else {
                             // the filter dropped the message;
                             m = CMD_IGNORE;
@@ -4219,10 +4691,8 @@ void CommonCore::processFilterReturn(ActionMessage& cmd)
                 }
                 if (filt->core_id == global_broker_id_local) {
                     // deal with local source filters
-                    auto tempMessage = createMessageFromCommand(std::move(cmd));
-                    tempMessage = filt->filterOp->process(std::move(tempMessage));
-                    if (tempMessage) {
-                        cmd = ActionMessage(std::move(tempMessage));
+                    if (filterMessage(*filt->filterOp, cmd)) {
+                        clearMessageRouting(cmd);
                     } else {
                         ongoingFilterProcesses[fid_index].erase(messID);
                         if (ongoingFilterProcesses[fid_index].empty()) {
@@ -4267,24 +4737,17 @@ void CommonCore::processMessageFilter(ActionMessage& cmd)
         if (FiltI != nullptr) {
             if ((!checkActionFlag(*FiltI, disconnected_flag)) && (FiltI->filterOp)) {
                 if (FiltI->cloning) {
-                    auto new_messages =
-                        FiltI->filterOp->processVector(createMessageFromCommand(std::move(cmd)));
-                    for (auto& msg : new_messages) {
-                        if (msg) {
-                            cmd = ActionMessage(std::move(msg));
-                            deliverMessage(cmd);
-                        }
-                    }
+                    cloneMessage(*FiltI->filterOp, cmd, [this](ActionMessage&& clone) {
+                        deliverMessage(clone);
+                    });
                 } else {
                     bool destFilter = (cmd.action() == CMD_SEND_FOR_DEST_FILTER_AND_RETURN);
                     bool returnToSender =
                         ((cmd.action() == CMD_SEND_FOR_FILTER_AND_RETURN) || destFilter);
                     auto source = cmd.getSource();
                     auto mid = cmd.messageID;
-                    auto tempMessage = createMessageFromCommand(std::move(cmd));
-                    tempMessage = FiltI->filterOp->process(std::move(tempMessage));
-                    if (tempMessage) {
-                        cmd = ActionMessage(std::move(tempMessage));
+                    if (filterMessage(*FiltI->filterOp, cmd)) {
+                        clearMessageRouting(cmd);
                     } else {
                         cmd = CMD_IGNORE;
                     }
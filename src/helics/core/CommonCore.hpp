@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "BrokerBase.hpp"
 #include "Core.hpp"
 #include "HandleManager.hpp"
+#include "RouteTable.hpp"
 #include "gmlc/concurrency/DelayedObjects.hpp"
 #include "gmlc/concurrency/TriggerVariable.hpp"
 #include "gmlc/containers/AirLock.hpp"
@@ -30,6 +31,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <memory>
 #include <set>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
@@ -150,6 +152,9 @@ class CommonCore: public Core, public BrokerBase {
     virtual const std::string& getInjectionType(interface_handle handle) const override final;
     virtual const std::string& getExtractionType(interface_handle handle) const override final;
     virtual void setValue(interface_handle handle, const char* data, uint64_t len) override final;
+    virtual void setValues(
+        const std::vector<interface_handle>& handles,
+        const std::vector<data_block>& values) override final;
     virtual std::shared_ptr<const data_block> getValue(interface_handle handle) override final;
     virtual std::vector<std::shared_ptr<const data_block>>
         getAllValues(interface_handle handle) override final;
@@ -250,11 +255,21 @@ class CommonCore: public Core, public BrokerBase {
      */
     virtual void brokerDisconnect() = 0;
 
+  public:
+    /** add a message generated by a local federate
+    @details if the core is sharded the message passes through the shard of the federate so it stays
+    in order with the values published by the federate*/
+    void addFederateMessage(local_federate_id federateID, const ActionMessage& cmd);
+
   protected:
+    virtual std::shared_ptr<helicsCLI11App> generateCLI() override;
+
     virtual void processCommand(ActionMessage&& cmd) override final;
 
     virtual void processPriorityCommand(ActionMessage&& cmd) override final;
 
+    virtual void processBatchEnd() override final;
+
     /** transit an ActionMessage to another core or broker
     @param rid the identifier for the route information to send the message to
     @param cmd the actionMessage to send*/
@@ -305,15 +320,15 @@ class CommonCore: public Core, public BrokerBase {
 
   private:
     std::string prevIdentifier; //!< storage for the case of requiring a renaming
-    std::map<global_federate_id, route_id>
-        routing_table; //!< map for external routes  <global federate id, route id>
+    RouteTable routing_table; //!< table of external routes indexed by the global federate id
     gmlc::containers::SimpleQueue<ActionMessage>
         delayTransmitQueue; //!< FIFO queue for transmissions to the root that need to be delayed for a certain time
-    std::unordered_map<std::string, route_id>
-        knownExternalEndpoints; //!< external map for all known external endpoints with names and route
 
     std::unique_ptr<TimeoutMonitor>
         timeoutMon; //!< class to handle timeouts and disconnection notices
+    /** find the local endpoint a message is addressed to
+    @return a pointer to the handle information or nullptr if the destination is not local*/
+    const BasicHandleInfo* findLocalDestination(const ActionMessage& message);
     /** actually transmit messages that were delayed until the core was actually registered*/
     void transmitDelayedMessages();
     /** respond to delayed message with an error*/
@@ -332,6 +347,12 @@ class CommonCore: public Core, public BrokerBase {
     void routeMessage(ActionMessage&& cmd, global_federate_id dest);
     /** function for routing a message from based on the destination specified in the ActionMessage*/
     void routeMessage(ActionMessage&& cmd);
+    /** send a message to a local federate from the core processing loop
+    @details in batch processing mode the message is held until the end of the batch and delivered with all the
+    other messages for that federate*/
+    void sendToFederate(FederateState* fed, const ActionMessage& cmd);
+    /** move a message to a local federate from the core processing loop*/
+    void sendToFederate(FederateState* fed, ActionMessage&& cmd);
 
     /** process any filter or route the message*/
     void processMessageFilter(ActionMessage& cmd);
@@ -393,6 +414,8 @@ class CommonCore: public Core, public BrokerBase {
     ordered_guarded<HandleManager> handles; //!< local handle information;
     HandleManager
         loopHandles; //!< copy of handles to use in the primary processing loop without thread protection
+    std::vector<std::pair<std::string, const BasicHandleInfo*>>
+        endpointDestinationCache; //!< the last local destination resolved by name for each source handle
     std::map<int32_t, std::set<int32_t>>
         ongoingFilterProcesses; //!< sets of ongoing filtered messages
     std::map<int32_t, std::set<int32_t>>
@@ -400,6 +423,12 @@ class CommonCore: public Core, public BrokerBase {
 
     std::map<int32_t, std::vector<ActionMessage>>
         delayedTimingMessages; //!< delayedTimingMessages from ongoing Filter actions
+    std::vector<std::vector<ActionMessage>>
+        federateBatches; //!< messages held for each local federate during batch processing
+    std::vector<FederateState*>
+        batchedFederates; //!< the federates with messages waiting in federateBatches
+    std::vector<ActionMessage>
+        heldRegistrations; //!< registrations and links waiting to be packed for the parent broker
     std::atomic<int> queryCounter{
         1}; //!< counter for queries start at 1 so the default value isn't used
     gmlc::concurrency::DelayedObjects<std::string> activeQueries; //!< holder for active queries
@@ -418,7 +447,34 @@ class CommonCore: public Core, public BrokerBase {
     std::array<gmlc::containers::AirLock<stx::any>, 4>
         dataAirlocks; //!< airlocks for updating filter operators and other functions
     gmlc::concurrency::TriggerVariable disconnection; //!< controller for the disconnection process
+
+    /** a worker thread delivering the values published by a subset of the local federates*/
+    struct FederateShard {
+        MpscPriorityQueue<ActionMessage> queue; //!< the traffic from the federates of the shard
+        std::thread worker; //!< the thread processing the queue
+        std::unordered_map<global_federate_id, FederateState*>
+            targets; //!< cache of the delivery targets,  nullptr for non local federates
+    };
+    int shardCount{0}; //!< the number of shards to split the local federates across,  0 for none
+    /// the shards of the local federates,  producers hold a shared lock while pushing to a shard so
+    /// stopShards can empty the vector without racing them
+    shared_guarded<std::vector<std::unique_ptr<FederateShard>>> shards;
+    std::atomic<bool> shardsActive{false}; //!< true if federate traffic goes through the shards
+
   private:
+    /** start the shard worker threads*/
+    void startShards();
+    /** stop the shard worker threads,  traffic left in the shards is forwarded to the main loop*/
+    void stopShards();
+    /** the processing loop of a shard worker thread*/
+    void shardProcessingLoop(FederateShard& shard, int index);
+    /** deliver a message from a shard to a local federate or forward it to the main loop*/
+    void shardDeliver(FederateShard& shard, ActionMessage&& cmd);
+    /** find the local federate a shard should deliver to
+    @return nullptr if the federate is not local to the core*/
+    FederateState* getShardTarget(FederateShard& shard, global_federate_id federateID);
+    /** add value traffic from a local federate,  through its shard if the core is sharded*/
+    void addFederateTraffic(local_federate_id federateID, ActionMessage&& cmd);
     /** wait for the core to be registered with the broker*/
     bool waitCoreRegistration();
     /** deliver a message to the appropriate location*/
@@ -458,6 +514,15 @@ class CommonCore: public Core, public BrokerBase {
     void setAsUsed(BasicHandleInfo* hand);
     /** function to consolidate the registration of interfaces in the core*/
     void registerInterface(ActionMessage& cmd);
+    /** send a registration or named link to the parent broker
+    @details consecutive registrations are held and sent together in a packed message*/
+    void transmitRegistration(ActionMessage&& cmd);
+    /** send any held registrations to the parent broker*/
+    void flushRegistrations();
+    /** route the values of a batch publication
+    @details values for local federates are delivered directly and the rest are sent in one packed
+    message per route*/
+    void routeValueBatch(ActionMessage& cmd);
     /** function to handle adding a target to an interface*/
     void addTargetToInterface(ActionMessage& cmd);
     /** function to deal with removing a target from an interface*/
@@ -457,6 +457,18 @@ class Core {
      */
     virtual void setValue(interface_handle handle, const char* data, uint64_t len) = 0;
 
+    /**
+     * Publish data on several publications of a federate in a single operation.
+     *
+     @details the handles are validated before any value is published and the values are passed to
+     the core as a single command
+     @param handles the handles of the publications,  all must belong to the same federate
+     @param values the raw data for each publication in the same order as the handles
+     */
+    virtual void setValues(
+        const std::vector<interface_handle>& handles,
+        const std::vector<data_block>& values) = 0;
+
     /**
      * Return the data for the specified handle or the latest input
      *
@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/logger.h"
 #include "BrokerFactory.hpp"
 #include "ForwardingTimeCoordinator.hpp"
+#include "StringPool.hpp"
 #include "TimeoutMonitor.h"
 #include "fileConnections.hpp"
 #include "gmlc/utilities/stringConversion.h"
@@ -20,6 +21,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "loggingHelper.hpp"
 #include "queryHelpers.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <utility>
@@ -80,9 +82,7 @@ route_id CoreBroker::getRoute(global_federate_id fedid) const
     if ((fedid == parent_broker_id) || (fedid == higher_broker_id)) {
         return parent_route_id;
     }
-    auto fnd = routing_table.find(fedid);
-    return (fnd != routing_table.end()) ? fnd->second :
-                                          parent_route_id; // zero is the default route
+    return routing_table.getRoute(fedid); // zero is the default route
 }
 
 BasicBrokerInfo* CoreBroker::getBrokerById(global_broker_id brokerid)
@@ -202,10 +202,6 @@ route_id CoreBroker::fillMessageRouteInformation(ActionMessage& mess)
         mess.setDestination(eptInfo->handle);
         return getRoute(eptInfo->handle.fed_id);
     }
-    auto fnd2 = knownExternalEndpoints.find(endpointName);
-    if (fnd2 != knownExternalEndpoints.end()) {
-        return fnd2->second;
-    }
     return parent_route_id;
 }
 
@@ -308,7 +304,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 auto route_id = _federates.back().route;
                 auto global_fedid = _federates.back().global_id;
 
-                routing_table.emplace(global_fedid, route_id);
+                routing_table.addRoute(global_fedid, route_id);
                 // don't bother with the federate_table
                 // transmit the response
                 ActionMessage fedReply(CMD_FED_ACK);
@@ -338,7 +334,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                     brk->route = route_id{routeCount++};
                     addRoute(
                         brk->route, command.getExtraData(), command.getString(targetStringLoc));
-                    routing_table[brk->global_id] = brk->route;
+                    routing_table.setRoute(brk->global_id, brk->route);
 
                     // sending the response message
                     ActionMessage brokerReply(CMD_BROKER_ACK);
@@ -464,7 +460,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 if (checkActionFlag(command, slow_responding_flag)) {
                     _brokers.back()._disable_ping = true;
                 }
-                routing_table.emplace(global_brkid, route);
+                routing_table.addRoute(global_brkid, route);
                 // don't bother with the broker_table for root broker
 
                 // sending the response message
@@ -493,13 +489,13 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 auto route = fed->route;
                 _federates.addSearchTerm(command.dest_id, fed->name);
                 transmit(route, command);
-                routing_table.emplace(fed->global_id, route);
+                routing_table.addRoute(fed->global_id, route);
             } else {
                 // this means we haven't seen this federate before for some reason
                 _federates.insert(command.name, command.dest_id, command.name);
                 _federates.back().route = getRoute(command.source_id);
                 _federates.back().global_id = command.dest_id;
-                routing_table.emplace(fed->global_id, _federates.back().route);
+                routing_table.addRoute(fed->global_id, _federates.back().route);
                 // it also means we don't forward it
             }
         } break;
@@ -542,7 +538,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 broker->global_id = global_broker_id(command.dest_id);
                 auto route = broker->route;
                 _brokers.addSearchTerm(global_broker_id(command.dest_id), broker->name);
-                routing_table.emplace(broker->global_id, route);
+                routing_table.addRoute(broker->global_id, route);
                 command.source_id =
                     global_broker_id_local; // we want the intermediate broker to change the source_id
                 transmit(route, command);
@@ -550,7 +546,7 @@ void CoreBroker::processPriorityCommand(ActionMessage&& command)
                 _brokers.insert(command.name, global_broker_id(command.dest_id), command.name);
                 _brokers.back().route = getRoute(command.source_id);
                 _brokers.back().global_id = global_broker_id(command.dest_id);
-                routing_table.emplace(broker->global_id, _brokers.back().route);
+                routing_table.addRoute(broker->global_id, _brokers.back().route);
             }
         } break;
         case CMD_PRIORITY_DISCONNECT: {
@@ -1065,6 +1061,9 @@ void CoreBroker::processCommand(ActionMessage&& command)
             }
             addPublication(command);
             break;
+        case CMD_MULTI_REGISTRATION:
+            processMultiRegistration(command);
+            break;
         case CMD_REG_INPUT:
             if ((!isRootc) && (command.dest_id != parent_broker_id)) {
                 routeMessage(command);
@@ -1476,7 +1475,7 @@ void CoreBroker::addPublication(ActionMessage& m)
 
     addLocalInfo(pub, m);
     if (!isRootc) {
-        transmit(parent_route_id, m);
+        routeMessage(m);
     } else {
         FindandNotifyPublicationTargets(pub);
     }
@@ -1497,7 +1496,7 @@ void CoreBroker::addInput(ActionMessage& m)
 
     addLocalInfo(inp, m);
     if (!isRootc) {
-        transmit(parent_route_id, m);
+        routeMessage(m);
     } else {
         FindandNotifyInputTargets(inp);
     }
@@ -1525,7 +1524,7 @@ void CoreBroker::addEndpoint(ActionMessage& m)
     addLocalInfo(ept, m);
 
     if (!isRootc) {
-        transmit(parent_route_id, m);
+        routeMessage(m);
         if (!hasTimeDependency) {
             if (timeCoord->addDependency(higher_broker_id)) {
                 hasTimeDependency = true;
@@ -1562,7 +1561,7 @@ void CoreBroker::addFilter(ActionMessage& m)
     addLocalInfo(filt, m);
 
     if (!isRootc) {
-        transmit(parent_route_id, m);
+        routeMessage(m);
         if (!hasFilters) {
             hasFilters = true;
             if (timeCoord->addDependent(higher_broker_id)) {
@@ -1808,6 +1807,10 @@ void CoreBroker::routeMessage(ActionMessage& cmd, global_federate_id dest)
 
 void CoreBroker::routeMessage(const ActionMessage& cmd)
 {
+    if (holdRoutedMessages) {
+        holdRoutedMessage(cmd);
+        return;
+    }
     if ((cmd.dest_id == parent_broker_id) || (cmd.dest_id == higher_broker_id)) {
         transmit(parent_route_id, cmd);
     } else {
@@ -1832,6 +1835,10 @@ void CoreBroker::routeMessage(ActionMessage&& cmd, global_federate_id dest)
 
 void CoreBroker::routeMessage(ActionMessage&& cmd)
 {
+    if (holdRoutedMessages) {
+        holdRoutedMessage(cmd);
+        return;
+    }
     if ((cmd.dest_id == parent_broker_id) || (cmd.dest_id == higher_broker_id)) {
         transmit(parent_route_id, std::move(cmd));
     } else {
@@ -1840,6 +1847,61 @@ void CoreBroker::routeMessage(ActionMessage&& cmd)
     }
 }
 
+void CoreBroker::processMultiRegistration(ActionMessage& command)
+{
+    if ((!isRootc) && (command.dest_id != parent_broker_id)) {
+        routeMessage(command);
+        return;
+    }
+    holdRoutedMessages = (registrationPackageSize > 0);
+    for (int ii = 0; ii < command.counter; ++ii) {
+        ActionMessage reg;
+        reg.from_string(command.getString(ii));
+        processCommand(std::move(reg));
+    }
+    holdRoutedMessages = false;
+    transmitHeldMessages();
+}
+
+void CoreBroker::holdRoutedMessage(const ActionMessage& cmd)
+{
+    auto route = ((cmd.dest_id == parent_broker_id) || (cmd.dest_id == higher_broker_id)) ?
+        parent_route_id :
+        getRoute(cmd.dest_id);
+    // a package is labeled with a single destination so messages are only packed together if they
+    // share both the route and the destination
+    auto held =
+        std::find_if(heldMessages.begin(), heldMessages.end(), [route, &cmd](const auto& rt) {
+            return (rt.first == route) && (rt.second.front().dest_id == cmd.dest_id);
+        });
+    if (held == heldMessages.end()) {
+        heldMessages.emplace_back(route, std::vector<ActionMessage>{});
+        held = heldMessages.end() - 1;
+    }
+    held->second.push_back(cmd);
+}
+
+void CoreBroker::transmitHeldMessages()
+{
+    for (auto& held : heldMessages) {
+        if (held.second.size() == 1) {
+            transmit(held.first, std::move(held.second.front()));
+            continue;
+        }
+        // registrations forwarded to a higher broker stay packed so it can process them in one pass
+        auto packages = packMessages(
+            held.second,
+            (held.first == parent_route_id) ? CMD_MULTI_REGISTRATION : CMD_MULTI_MESSAGE,
+            static_cast<std::size_t>(registrationPackageSize));
+        for (auto& package : packages) {
+            package.source_id = global_broker_id_local;
+            package.dest_id = held.second.front().dest_id;
+            transmit(held.first, std::move(package));
+        }
+    }
+    heldMessages.clear();
+}
+
 void CoreBroker::broadcast(ActionMessage& cmd)
 {
     for (auto& broker : _brokers) {
@@ -1953,7 +2015,7 @@ void CoreBroker::FindandNotifyInputTargets(BasicHandleInfo& handleInfo)
         m.setSource(handleInfo.handle);
         m.payload = handleInfo.type;
         m.flags = handleInfo.flags;
-        transmit(getRoute(m.dest_id), m);
+        routeMessage(m);
 
         // notify the subscriber about its publisher
         m.setAction(CMD_ADD_PUBLISHER);
@@ -1965,7 +2027,7 @@ void CoreBroker::FindandNotifyInputTargets(BasicHandleInfo& handleInfo)
             m.setStringData(pub->type, pub->units);
         }
 
-        transmit(getRoute(m.dest_id), std::move(m));
+        routeMessage(std::move(m));
     }
     if (!Handles.empty()) {
         unknownHandles.clearInput(handleInfo.key);
@@ -1982,7 +2044,7 @@ void CoreBroker::FindandNotifyPublicationTargets(BasicHandleInfo& handleInfo)
         m.setDestination(handleInfo.handle);
         m.flags = sub.second;
 
-        transmit(getRoute(m.dest_id), m);
+        routeMessage(m);
 
         // notify the subscriber about its publisher
         m.setAction(CMD_ADD_PUBLISHER);
@@ -1991,7 +2053,7 @@ void CoreBroker::FindandNotifyPublicationTargets(BasicHandleInfo& handleInfo)
         m.payload = handleInfo.type;
         m.flags = handleInfo.flags;
         m.setStringData(handleInfo.type, handleInfo.units);
-        transmit(getRoute(m.dest_id), std::move(m));
+        routeMessage(std::move(m));
     }
 
     auto Pubtargets = unknownHandles.checkForLinks(handleInfo.key);
@@ -2015,13 +2077,13 @@ void CoreBroker::FindandNotifyEndpointTargets(BasicHandleInfo& handleInfo)
         m.setSource(handleInfo.handle);
         m.setDestination(target.first);
         m.flags = target.second;
-        transmit(getRoute(m.dest_id), m);
+        routeMessage(m);
 
         // notify the endpoint about its filter
         m.setAction(CMD_ADD_FILTER);
         m.swapSourceDest();
         m.flags = target.second;
-        transmit(getRoute(m.dest_id), m);
+        routeMessage(m);
     }
 
     if (!Handles.empty()) {
@@ -2044,13 +2106,13 @@ void CoreBroker::FindandNotifyFilterTargets(BasicHandleInfo& handleInfo)
         if ((!handleInfo.type_in.empty()) || (!handleInfo.type_out.empty())) {
             m.setStringData(handleInfo.type_in, handleInfo.type_out);
         }
-        transmit(getRoute(m.dest_id), m);
+        routeMessage(m);
 
         // notify the filter about an endpoint
         m.setAction(CMD_ADD_ENDPOINT);
         m.swapSourceDest();
         m.clearStringData();
-        transmit(getRoute(m.dest_id), m);
+        routeMessage(m);
     }
 
     auto FiltDestTargets = unknownHandles.checkForFilterDestTargets(handleInfo.key);
@@ -2410,9 +2472,9 @@ std::string CoreBroker::generateQueryAnswer(const std::string& request)
         return getIdentifier();
     }
     if ((request == "queries") || (request == "available_queries")) {
-        return "[isinit;isconnected;name;address;queries;address;counts;summary;federates;brokers;inputs;endpoints;"
-               "publications;filters;federate_map;dependency_graph;data_flow_graph;dependencies;dependson;dependents;"
-               "current_time;current_state;global_time]";
+        return "[isinit;isconnected;name;address;queries;address;counts;memory;summary;federates;brokers;"
+               "inputs;endpoints;publications;filters;federate_map;dependency_graph;data_flow_graph;"
+               "dependencies;dependson;dependents;current_time;time_updates;current_state;global_time;placement]";
     }
     if (request == "address") {
         return getAddress();
@@ -2429,6 +2491,23 @@ std::string CoreBroker::generateQueryAnswer(const std::string& request)
         base["handles"] = static_cast<int>(handles.size());
         return generateJsonString(base);
     }
+    if (request == "memory") {
+        auto usage = StringPool::getMemoryUsage();
+        Json::Value base;
+        base["name"] = getIdentifier();
+        base["id"] = global_broker_id_local.baseValue();
+        base["handles"] = static_cast<int>(handles.size());
+        // the string pool is shared by every core and broker in the process
+        Json::Value pool;
+        pool["interned_strings"] = static_cast<Json::UInt64>(usage.count);
+        pool["interned_bytes"] = static_cast<Json::UInt64>(usage.bytes);
+        pool["saved_bytes"] = static_cast<Json::UInt64>(usage.savedBytes);
+        base["process_string_pool"] = pool;
+        return generateJsonString(base);
+    }
+    if (request == "placement") {
+        return generateThreadPlacementJson(getIdentifier(), getThreadPlacement());
+    }
     if (request == "summary") {
         return generateFederationSummary();
     }
@@ -2476,6 +2555,9 @@ std::string CoreBroker::generateQueryAnswer(const std::string& request)
             return "{}";
         }
     }
+    if (request == "time_updates") {
+        return timeCoord->printUpdateCounts();
+    }
     auto mi = mapIndex.find(request);
     if (mi != mapIndex.end()) {
         auto index = mi->second.first;
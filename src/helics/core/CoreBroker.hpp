@@ -12,6 +12,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "Broker.hpp"
 #include "BrokerBase.hpp"
 #include "HandleManager.hpp"
+#include "RouteTable.hpp"
 #include "TimeDependencies.hpp"
 #include "UnknownHandleManager.hpp"
 #include "federate_id_extra.hpp"
@@ -110,10 +111,7 @@ class CoreBroker: public Broker, public BrokerBase {
         delayedDependencies; //!< set of dependencies that need to be created on init
     std::unordered_map<global_federate_id, local_federate_id>
         global_id_translation; //!< map to translate global ids to local ones
-    std::unordered_map<global_federate_id, route_id>
-        routing_table; //!< map for external routes  <global federate id, route id>
-    std::unordered_map<std::string, route_id>
-        knownExternalEndpoints; //!< external map for all known external endpoints with names and route
+    RouteTable routing_table; //!< table of external routes indexed by the global federate id
     std::unordered_map<std::string, std::string> global_values; //!< storage for global values
     std::mutex name_mutex_; //!< mutex lock for name and identifier
     std::atomic<int> queryCounter{1}; // counter for active queries going to the local API
@@ -122,6 +120,10 @@ class CoreBroker: public Broker, public BrokerBase {
     std::vector<std::tuple<JsonMapBuilder, std::vector<ActionMessage>, bool>> mapBuilders;
 
     std::vector<ActionMessage> earlyMessages; //!< list of messages that came before connection
+    bool holdRoutedMessages{
+        false}; //!< set while a packed registration is processed so the results can be packed
+    std::vector<std::pair<route_id, std::vector<ActionMessage>>>
+        heldMessages; //!< messages held during a packed registration by route and destination
     gmlc::concurrency::TriggerVariable disconnection; //!< controller for the disconnection process
     std::unique_ptr<TimeoutMonitor>
         timeoutMon; //!< class to handle timeouts and disconnection notices
@@ -156,6 +158,13 @@ class CoreBroker: public Broker, public BrokerBase {
     void routeMessage(ActionMessage&& cmd);
     /** transmit a message to the parent or root */
     void transmitToParent(ActionMessage&& cmd);
+    /** process all the registrations and links in a packed registration message in a single pass
+    @details the messages generated to link the interfaces are packed for each route*/
+    void processMultiRegistration(ActionMessage& command);
+    /** hold a routed message until the current packed registration is complete*/
+    void holdRoutedMessage(const ActionMessage& cmd);
+    /** pack and transmit the held messages for each route*/
+    void transmitHeldMessages();
     /** propagate an error message or escalate it depending on settings*/
     void propagateError(ActionMessage&& cmd);
     /** broadcast a message to all immediate brokers*/
@@ -7,8 +7,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "EndpointInfo.hpp"
 //#include "core/core-data.hpp"
 
-#include <algorithm>
-#include <cstring>
+#include <iterator>
 #include <memory>
 #include <utility>
 
@@ -16,52 +15,89 @@ namespace helics {
 std::unique_ptr<Message> EndpointInfo::getMessage(Time maxTime)
 {
     auto handle = message_queue.lock();
-    if (handle->empty()) {
+    if (handle->messages.empty()) {
         return nullptr;
     }
-    if (handle->front()->time <= maxTime) {
-        auto msg = std::move(handle->front());
-        handle->pop_front();
+    auto front = handle->messages.begin();
+    if (front->first.time <= maxTime) {
+        if (front->first.time <= handle->countTime) {
+            --handle->count;
+        }
+        auto msg = std::move(front->second);
+        handle->messages.erase(front);
         return msg;
     }
     return nullptr;
 }
 
+std::vector<std::unique_ptr<Message>> EndpointInfo::getMessages(Time maxTime)
+{
+    std::vector<std::unique_ptr<Message>> result;
+    auto handle = message_queue.lock();
+    auto last = handle->messages.upper_bound(maxTime);
+    for (auto it = handle->messages.begin(); it != last; ++it) {
+        result.push_back(std::move(it->second));
+    }
+    handle->messages.erase(handle->messages.begin(), last);
+    // all the messages counted were removed unless the count extends beyond maxTime
+    handle->count = (maxTime < handle->countTime) ?
+        handle->count - static_cast<int32_t>(result.size()) :
+        0;
+    return result;
+}
+
 Time EndpointInfo::firstMessageTime() const
 {
     auto handle = message_queue.lock_shared();
-    return (handle->empty()) ? Time::maxVal() : handle->front()->time;
+    return (handle->messages.empty()) ? Time::maxVal() : handle->messages.begin()->first.time;
 }
-// this is the function which determines message order
-static auto msgSorter = [](const auto& m1, const auto& m2) {
-    // first by time
-    return (m1->time != m2->time) ? (m1->time < m2->time) :
-                                    (m1->original_source < m2->original_source);
-};
 
 void EndpointInfo::addMessage(std::unique_ptr<Message> message)
 {
+    auto* msg = message.get();
+    messageKey key{msg->time, &msg->original_source};
     auto handle = message_queue.lock();
-    handle->push_back(std::move(message));
-    std::stable_sort(handle->begin(), handle->end(), msgSorter);
+    auto& messages = handle->messages;
+    // messages mostly arrive in order so check the end first, both insertions place the new message
+    // after any messages with an equal key
+    if (messages.empty() || !messageKeyLess()(key, std::prev(messages.end())->first)) {
+        messages.emplace_hint(messages.end(), key, std::move(message));
+    } else {
+        messages.emplace(key, std::move(message));
+    }
+    if (key.time <= handle->countTime) {
+        ++handle->count;
+    }
 }
 
 void EndpointInfo::clearQueue()
 {
-    message_queue.lock()->clear();
+    auto handle = message_queue.lock();
+    handle->messages.clear();
+    handle->count = 0;
 }
 
 int32_t EndpointInfo::queueSize(Time maxTime) const
 {
-    auto handle = message_queue.lock_shared();
-    int32_t cnt = 0;
-    for (auto& msg : *handle) {
-        if (msg->time <= maxTime) {
-            ++cnt;
+    {
+        auto handle = message_queue.lock_shared();
+        if (handle->countTime == maxTime) {
+            return handle->count;
+        }
+    }
+    auto handle = message_queue.lock();
+    if (handle->countTime != maxTime) {
+        const auto& messages = handle->messages;
+        // adjust the count by the messages between the old and new times
+        if (maxTime > handle->countTime) {
+            handle->count += static_cast<int32_t>(std::distance(
+                messages.upper_bound(handle->countTime), messages.upper_bound(maxTime)));
         } else {
-            break;
+            handle->count -= static_cast<int32_t>(std::distance(
+                messages.upper_bound(maxTime), messages.upper_bound(handle->countTime)));
         }
+        handle->countTime = maxTime;
     }
-    return cnt;
+    return handle->count;
 }
 } // namespace helics
@@ -7,32 +7,65 @@ SPDX-License-Identifier: BSD-3-Clause
 #pragma once
 
 #include "../common/GuardedTypes.hpp"
+#include "StringPool.hpp"
 #include "basic_core_types.hpp"
 
-#include <deque>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 namespace helics {
 /** data class containing the information about an endpoint*/
 class EndpointInfo {
   public:
     /** constructor from all data*/
     EndpointInfo(global_handle handle, const std::string& key_, const std::string& type_):
-        id(handle), key(key_), type(type_)
+        id(handle), keyHandle(StringPool::intern(key_)), typeHandle(StringPool::intern(type_)),
+        key(*keyHandle), type(*typeHandle)
     {
     }
 
     const global_handle id; //!< identifier for the handle
-    const std::string key; //!< name of the endpoint
-    const std::string type; //!< type of the endpoint
   private:
-    shared_guarded<std::deque<std::unique_ptr<Message>>>
-        message_queue; //!< storage for the messages
+    const StringPool::handle keyHandle; //!< the pool reference for the key
+    const StringPool::handle typeHandle; //!< the pool reference for the type
+
+  public:
+    const std::string& key; //!< name of the endpoint (interned)
+    const std::string& type; //!< type of the endpoint (interned)
+  private:
+    /** key for ordering the messages, first by time then by original source
+    @details messages with equal keys are kept in the order they were received*/
+    struct messageKey {
+        Time time; //!< the message time
+        const std::string* source; //!< the original_source of the message the key belongs to
+    };
+    /** comparison for the message keys which also allows searching by time alone*/
+    struct messageKeyLess {
+        using is_transparent = void;
+        bool operator()(const messageKey& k1, const messageKey& k2) const
+        {
+            return (k1.time != k2.time) ? (k1.time < k2.time) : (*k1.source < *k2.source);
+        }
+        bool operator()(Time t1, const messageKey& k2) const { return t1 < k2.time; }
+        bool operator()(const messageKey& k1, Time t2) const { return k1.time < t2; }
+    };
+    /** the time ordered messages and a cached count of the messages available at a given time*/
+    struct messageStore {
+        std::multimap<messageKey, std::unique_ptr<Message>, messageKeyLess> messages;
+        Time countTime{Time::minVal()}; //!< the time the count is valid for
+        int32_t count{0}; //!< the number of messages with a time <= countTime
+    };
+    mutable shared_guarded<messageStore> message_queue; //!< storage for the messages
   public:
     bool hasFilter = false; //!< indicator that the message has a filter
     /** get the next message up to the specified time*/
     std::unique_ptr<Message> getMessage(Time maxTime);
-    /** get the number of messages in the queue up to the specified time*/
+    /** get all the messages up to the specified time in order*/
+    std::vector<std::unique_ptr<Message>> getMessages(Time maxTime);
+    /** get the number of messages in the queue up to the specified time
+    @details the count is cached so repeated calls with the same time are constant time*/
     int32_t queueSize(Time maxTime) const;
     /** add a message to the queue*/
     void addMessage(std::unique_ptr<Message> message);
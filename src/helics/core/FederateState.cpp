@@ -149,6 +149,8 @@ void FederateState::reset()
     interfaceInformation.setGlobalId(global_federate_id());
     local_id = local_federate_id();
     state = HELICS_CREATED;
+    // clearing the queue is a consumer operation so it needs the processing lock
+    std::lock_guard<FederateState> plock(*this);
     queue.clear();
     delayQueues.clear();
     // TODO(PT): this probably needs to do a lot more
@@ -157,6 +159,7 @@ void FederateState::reset()
 void FederateState::reInit()
 {
     state = HELICS_INITIALIZING;
+    std::lock_guard<FederateState> plock(*this);
     queue.clear();
     delayQueues.clear();
     // TODO(PT): this needs to reset a bunch of stuff as well as check a few things
@@ -191,6 +194,7 @@ void FederateState::generateConfig(Json::Value& base) const
     base["source_only"] = source_only;
     base["strict_input_type_checking"] = source_only;
     base["slow_responding"] = slow_responding;
+    base["busy_poll"] = busy_poll;
     if (rt_lag > timeZero) {
         base["rt_lag"] = static_cast<double>(rt_lag);
     }
@@ -255,7 +259,7 @@ std::unique_ptr<Message> FederateState::receiveAny(interface_handle& id)
 void FederateState::routeMessage(const ActionMessage& msg)
 {
     if (parent_ != nullptr) {
-        parent_->addActionMessage(msg);
+        parent_->addFederateMessage(local_id, msg);
     } else {
         queue.push(msg);
     }
@@ -275,6 +279,13 @@ void FederateState::addAction(ActionMessage&& action)
     }
 }
 
+void FederateState::addActions(const std::vector<ActionMessage>& actions)
+{
+    if (!actions.empty()) {
+        queue.pushVector(actions);
+    }
+}
+
 void FederateState::createInterface(
     handle_type htype,
     interface_handle handle,
@@ -747,6 +758,33 @@ bool FederateState::messageShouldBeDelayed(const ActionMessage& cmd) const
     }
 }
 
+ActionMessage FederateState::getNextMessage()
+{
+    if (!busy_poll) {
+        return queue.pop();
+    }
+    // check the clock and give up the processor periodically so the core thread is not starved on
+    // an oversubscribed machine
+    constexpr int pollCheckInterval{256};
+    const auto start = std::chrono::steady_clock::now();
+    const auto budget = std::chrono::microseconds(busy_poll_budget);
+    int polls{0};
+    while (true) {
+        auto cmd = queue.try_pop();
+        if (cmd) {
+            return std::move(*cmd);
+        }
+        if (++polls < pollCheckInterval) {
+            continue;
+        }
+        polls = 0;
+        if (busy_poll_budget > 0 && std::chrono::steady_clock::now() - start > budget) {
+            return queue.pop();
+        }
+        std::this_thread::yield();
+    }
+}
+
 message_processing_result FederateState::processQueue() noexcept
 {
     if (state == HELICS_FINISHED) {
@@ -758,7 +796,7 @@ message_processing_result FederateState::processQueue() noexcept
     auto ret_code = processDelayQueue();
 
     while (!(returnableResult(ret_code))) {
-        auto cmd = queue.pop();
+        auto cmd = getNextMessage();
         if (messageShouldBeDelayed(cmd)) {
             delayQueues[cmd.source_id].push_back(cmd);
             continue;
@@ -1054,11 +1092,12 @@ message_processing_result FederateState::processActionMessage(ActionMessage& cmd
             }
             for (auto& src : subI->input_sources) {
                 if ((cmd.source_id == src.fed_id) && (cmd.source_handle == src.handle)) {
-                    subI->addData(
-                        src,
-                        cmd.actionTime,
-                        cmd.counter,
-                        std::make_shared<const data_block>(std::move(cmd.payload)));
+                    // values delivered locally may already be in a shared buffer
+                    auto data = cmd.getSharedPayload();
+                    if (!data) {
+                        data = std::make_shared<const data_block>(std::move(cmd.payload));
+                    }
+                    subI->addData(src, cmd.actionTime, cmd.counter, std::move(data));
                     if (!subI->not_interruptible) {
                         timeCoord->updateValueTime(cmd.actionTime);
                         LOG_TRACE(timeCoord->printTimeStatus());
@@ -1343,6 +1382,9 @@ void FederateState::setProperty(int intProperty, int propertyVal)
         case defs::properties::console_log_level:
             logLevel = propertyVal;
             break;
+        case defs::properties::busy_poll_budget:
+            busy_poll_budget = (propertyVal > 0) ? propertyVal : 0;
+            break;
         case defs::properties::rt_lag:
             rt_lag = helics::Time(static_cast<double>(propertyVal));
             break;
@@ -1377,6 +1419,9 @@ void FederateState::setOptionFlag(int optionFlag, bool value)
         case defs::flags::slow_responding:
             slow_responding = value;
             break;
+        case defs::flags::busy_poll:
+            busy_poll = value;
+            break;
         case defs::flags::terminate_on_error:
             terminate_on_error = value;
             break;
@@ -1461,6 +1506,8 @@ bool FederateState::getOptionFlag(int optionFlag) const
             return source_only;
         case defs::flags::slow_responding:
             return slow_responding;
+        case defs::flags::busy_poll:
+            return busy_poll;
         case defs::flags::terminate_on_error:
             return terminate_on_error;
         case defs::flags::connections_required:
@@ -1501,6 +1548,8 @@ int FederateState::getIntegerProperty(int intProperty) const
         case defs::properties::file_log_level:
         case defs::properties::console_log_level:
             return logLevel;
+        case defs::properties::busy_poll_budget:
+            return busy_poll_budget;
         default:
             return timeCoord->getIntegerProperty(intProperty);
     }
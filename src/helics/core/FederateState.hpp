@@ -10,9 +10,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "ActionMessage.hpp"
 #include "BasicHandleInfo.hpp"
 #include "InterfaceInfo.hpp"
+#include "MpscPriorityQueue.hpp"
 #include "core-data.hpp"
 #include "core-types.hpp"
-#include "gmlc/containers/BlockingQueue.hpp"
 #include "helics-time.hpp"
 
 #include <atomic>
@@ -72,6 +72,8 @@ class FederateState {
     bool ignore_unit_mismatch{false}; //!< flag to ignore mismatching units
     bool slow_responding{
         false}; //!< flag indicating that a federate is likely to be slow in responding
+    bool busy_poll{false}; //!< flag indicating that the federate spins waiting for messages
+    int busy_poll_budget{0}; //!< the number of microseconds to spin before sleeping, 0 for no limit
     InterfaceInfo interfaceInformation; //!< the container for the interface information objects
 
   public:
@@ -100,8 +102,10 @@ class FederateState {
   private:
     std::shared_ptr<MessageTimer>
         mTimer; //!< message timer object for real time operations and timeouts
-    gmlc::containers::BlockingQueue<ActionMessage>
-        queue; //!< processing queue for messages incoming to a federate
+    /** processing queue for messages incoming to a federate
+    @details the core and the federate push into the queue without locking and only the thread
+    processing the federate extracts from it*/
+    MpscPriorityQueue<ActionMessage> queue;
     std::atomic<uint16_t> interfaceFlags{
         0}; //!< current defaults for operational flags of interfaces for this federate
     std::map<global_federate_id, std::deque<ActionMessage>>
@@ -133,9 +137,11 @@ class FederateState {
     void generateConfig(Json::Value& base) const;
 
   public:
-    /** reset the federate to created state*/
+    /** reset the federate to created state
+    @details takes the processing lock so must not be called while holding it*/
     void reset();
-    /** reset the federate to the initializing state*/
+    /** reset the federate to the initializing state
+    @details takes the processing lock so must not be called while holding it*/
     void reInit();
     /** get the name of the federate*/
     const std::string& getIdentifier() const { return name; }
@@ -309,6 +315,8 @@ class FederateState {
     */
     std::vector<global_handle> getSubscribers(interface_handle handle);
 
+    /** get the next message from the queue spinning on it if the federate is busy polling*/
+    ActionMessage getNextMessage();
     /** function to process the queue in a generic fashion used to just process messages
     with no specific end in mind
     */
@@ -320,6 +328,8 @@ class FederateState {
     void addAction(const ActionMessage& action);
     /** move a message to the queue*/
     void addAction(ActionMessage&& action);
+    /** add a set of messages to the queue with a single lock and notification*/
+    void addActions(const std::vector<ActionMessage>& actions);
     /** sometime a message comes in after a federate has terminated and may require a response*/
     opt<ActionMessage> processPostTerminationAction(const ActionMessage& action);
     /** log a message to the federate Logger
@@ -29,6 +29,8 @@ void ForwardingTimeCoordinator::enteringExecMode()
 
 void ForwardingTimeCoordinator::disconnect()
 {
+    // any held update is irrelevant once disconnected
+    pendingUpdate = false;
     if (sendMessageFunction) {
         std::set<global_federate_id> connections(dependents.begin(), dependents.end());
         for (auto dep : dependencies) {
@@ -78,10 +80,8 @@ class minTimeSet {
     DependencyInfo::time_state_t tState = DependencyInfo::time_state_t::time_requested;
 };
 
-static minTimeSet generateMinTimeSet(
-    const TimeDependencies& dependencies,
-    bool restricted,
-    global_federate_id ignore = global_federate_id())
+/** compute the minimum times by scanning all the dependencies*/
+static minTimeSet scanMinTimeSet(const TimeDependencies& dependencies, global_federate_id ignore)
 {
     minTimeSet mTime;
     for (auto& dep : dependencies) {
@@ -113,6 +113,32 @@ static minTimeSet generateMinTimeSet(
             mTime.minDe = dep.Te;
         }
     }
+    return mTime;
+}
+
+static minTimeSet generateMinTimeSet(
+    const TimeDependencies& dependencies,
+    bool restricted,
+    global_federate_id ignore = global_federate_id())
+{
+    minTimeSet mTime;
+    if (!ignore.isValid() && !dependencies.hasInvalidDependentEvents()) {
+        // the minimums are tracked by the dependencies so no scan is needed
+        const auto* minDep = dependencies.getMinNextDependency();
+        if (minDep != nullptr) {
+            mTime.minNext = minDep->Tnext;
+            // only granted dependencies change the state when all the dependencies are at the maximum time
+            if (minDep->Tnext < Time::maxVal() ||
+                minDep->time_state == DependencyInfo::time_state_t::time_granted) {
+                mTime.tState = minDep->time_state;
+            }
+        }
+        mTime.minminDe = dependencies.getMinDependentEvent();
+        mTime.minFed = dependencies.getMinDependentEventFederate();
+        mTime.minDe = dependencies.getMinEvent();
+    } else {
+        mTime = scanMinTimeSet(dependencies, ignore);
+    }
 
     mTime.minminDe = std::min(mTime.minDe, mTime.minminDe);
 
@@ -161,15 +187,44 @@ void ForwardingTimeCoordinator::updateTimeFactors()
         }
     }
     if (update) {
-        sendTimeRequest();
+        if (coalesceUpdates) {
+            if (pendingUpdate) {
+                ++updatesSuperseded;
+            }
+            pendingUpdate = true;
+        } else {
+            sendTimeRequest();
+        }
     }
 }
 
-void ForwardingTimeCoordinator::sendTimeRequest() const
+void ForwardingTimeCoordinator::flushUpdates()
+{
+    if (!pendingUpdate) {
+        return;
+    }
+    pendingUpdate = false;
+    if (time_next == sent_next && time_minDe == sent_minDe && time_minminDe == sent_minminDe &&
+        time_state == sent_state && lastMinFed == sent_minFed && iterating == sent_iterating) {
+        // the intermediate changes cancelled out so the dependents already have this state
+        ++updatesUnchanged;
+        return;
+    }
+    sendTimeRequest();
+}
+
+void ForwardingTimeCoordinator::sendTimeRequest()
 {
     if (!sendMessageFunction) {
         return;
     }
+    sent_next = time_next;
+    sent_minDe = time_minDe;
+    sent_minminDe = time_minminDe;
+    sent_state = time_state;
+    sent_minFed = lastMinFed;
+    sent_iterating = iterating;
+    ++updatesSent;
     if (time_state == DependencyInfo::time_state_t::time_granted) {
         ActionMessage upd(CMD_TIME_GRANT);
         upd.source_id = source_id;
@@ -205,6 +260,16 @@ std::string ForwardingTimeCoordinator::printTimeStatus() const
         static_cast<double>(time_minminDe));
 }
 
+std::string ForwardingTimeCoordinator::printUpdateCounts() const
+{
+    return fmt::format(
+        R"raw({{"coalescing":{}, "sent":{}, "superseded":{}, "unchanged":{}}})raw",
+        coalesceUpdates,
+        updatesSent,
+        updatesSuperseded,
+        updatesUnchanged);
+}
+
 bool ForwardingTimeCoordinator::isDependency(global_federate_id ofed) const
 {
     return dependencies.isDependency(ofed);
@@ -277,6 +342,7 @@ message_processing_result ForwardingTimeCoordinator::checkExecEntry()
     ret = message_processing_result::next_step;
 
     executionMode = true;
+    pendingUpdate = false;
     time_next = timeZero;
     time_state = DependencyInfo::time_state_t::time_granted;
     time_minDe = timeZero;
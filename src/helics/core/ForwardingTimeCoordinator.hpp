@@ -11,6 +11,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "TimeDependencies.hpp"
 
 #include <atomic>
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <utility>
@@ -39,6 +40,19 @@ class ForwardingTimeCoordinator {
     std::function<void(const ActionMessage&)>
         sendMessageFunction; //!< callback used to send the messages
 
+    // the state of the last timing update sent, used to drop updates that would not change anything
+    Time sent_next{timeZero}; //!< the next time in the last update sent
+    Time sent_minminDe{timeZero}; //!< the minimum dependency event time in the last update sent
+    Time sent_minDe{timeZero}; //!< the minimum event time in the last update sent
+    DependencyInfo::time_state_t sent_state{
+        DependencyInfo::time_state_t::initialized}; //!< the time state in the last update sent
+    global_federate_id sent_minFed{}; //!< the minimum federate when the last update was sent
+    bool sent_iterating{false}; //!< the iteration flag of the last update sent
+    bool pendingUpdate{false}; //!< indicator that an update is being held for the next flush
+    std::uint64_t updatesSent{0}; //!< the number of timing updates sent
+    std::uint64_t updatesSuperseded{0}; //!< the number of held updates replaced by a later update
+    std::uint64_t updatesUnchanged{0}; //!< the number of held updates dropped as identical to the last one sent
+
   public:
     global_federate_id source_id{
         0}; //!< the identifier for inserting into the source id field of any generated messages;
@@ -49,6 +63,8 @@ class ForwardingTimeCoordinator {
     bool ignoreMinFed{false}; //!< flag indicating that minFed Controls should not be used
     bool restrictive_time_policy{
         false}; //!< flag indicating that a restrictive time policy should be used
+    bool coalesceUpdates{
+        false}; //!< flag indicating that timing updates are held until flushUpdates is called
   public:
     ForwardingTimeCoordinator() = default;
 
@@ -67,6 +83,11 @@ class ForwardingTimeCoordinator {
     and send an update if needed
     */
     void updateTimeFactors();
+    /** send the timing update held in coalescing mode if it differs from the last update sent
+    @details intended to be called after a batch of incoming messages has been processed*/
+    void flushUpdates();
+    /** generate a string with the counts of the timing updates sent and suppressed*/
+    std::string printUpdateCounts() const;
 
     /** take a global id and get a pointer to the dependencyInfo for the other fed
     will be nullptr if it doesn't exist
@@ -77,7 +98,7 @@ class ForwardingTimeCoordinator {
 
   private:
     /**send out the latest time request command*/
-    void sendTimeRequest() const;
+    void sendTimeRequest();
     void transmitTimingMessage(ActionMessage& msg) const;
     /** generate a new timing request message by recalculating the times ignoring a particular brokers input
      */
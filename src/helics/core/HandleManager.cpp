@@ -74,7 +74,8 @@ void HandleManager::removeHandle(global_handle handle)
                 break;
         }
     }
-    // construct a blank at the previous index
+    // construct a blank at the previous index, destroying the old one releases its pool strings
+    info.~BasicHandleInfo();
     new (&(handles[index])) BasicHandleInfo;
 }
 
@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 #include "BasicHandleInfo.hpp"
+#include "StringPool.hpp"
 #include "Core.hpp"
 #include "helics-time.hpp"
 
@@ -28,11 +29,11 @@ class HandleManager {
     the same thing just with different container types so using deque reduce the amount of the code to maintain as
     well*/
     std::deque<BasicHandleInfo> handles; //!< local handle information
-    std::unordered_map<std::string, interface_handle>
-        publications; //!< map of all local publications
-    std::unordered_map<std::string, interface_handle> endpoints; //!< map of all local endpoints
-    std::unordered_map<std::string, interface_handle> inputs; //!< map of all local endpoints
-    std::unordered_map<std::string, interface_handle> filters; //!< map of all local endpoints
+    // the name maps are keyed by the interned keys stored in the handles
+    string_ref_map<interface_handle> publications; //!< map of all local publications
+    string_ref_map<interface_handle> endpoints; //!< map of all local endpoints
+    string_ref_map<interface_handle> inputs; //!< map of all local endpoints
+    string_ref_map<interface_handle> filters; //!< map of all local endpoints
     std::unordered_map<std::uint64_t, int32_t> unique_ids; //!< map of identifiers
   public:
     /** default constructor*/
@@ -0,0 +1,208 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "gmlc/containers/extra/optional.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace helics {
+/** lock free multiple producer single consumer queue with a priority channel
+@details adding an element is a single atomic exchange so producers never wait on each other or on the
+consumer.  Only a single thread may call the pop functions. On an empty queue the consumer spins for a short time
+before parking on a condition variable, producers only touch the mutex if the consumer is actually parked.  The
+length of the spin adapts to the consumer,  it grows when data tends to arrive while spinning and shrinks when
+the consumer ends up parking anyway.
+*/
+template<class T>
+class MpscPriorityQueue {
+  private:
+    struct node {
+        std::atomic<node*> next{nullptr};
+        T value;
+        node() = default;
+        template<class... Args>
+        explicit node(Args&&... args): value(std::forward<Args>(args)...)
+        {
+        }
+    };
+    /** single channel of the queue, a linked list with an atomic head for the producers and a tail
+    owned by the consumer,  the tail node is always a placeholder whose value has been extracted*/
+    class channel {
+      public:
+        channel(): head(new node), tail(head.load()) {}
+        ~channel()
+        {
+            while (tail != nullptr) {
+                node* nextNode = tail->next.load(std::memory_order_relaxed);
+                delete tail;
+                tail = nextNode;
+            }
+        }
+        channel(const channel&) = delete;
+        channel& operator=(const channel&) = delete;
+
+        void push(node* newNode)
+        {
+            node* prev = head.exchange(newNode, std::memory_order_seq_cst);
+            prev->next.store(newNode, std::memory_order_release);
+        }
+        /** link a chain of nodes that are already connected to each other in a single operation*/
+        void pushChain(node* first, node* last)
+        {
+            node* prev = head.exchange(last, std::memory_order_seq_cst);
+            prev->next.store(first, std::memory_order_release);
+        }
+        bool try_pop(stx::optional<T>& val)
+        {
+            node* nextNode = tail->next.load(std::memory_order_acquire);
+            if (nextNode == nullptr) {
+                return false;
+            }
+            val.emplace(std::move(nextNode->value));
+            delete tail;
+            tail = nextNode;
+            return true;
+        }
+        /** check for pending elements,  this is true as soon as a producer has claimed the head even if the
+        element is not yet linked in*/
+        bool empty() const { return head.load(std::memory_order_seq_cst) == tail; }
+
+      private:
+        std::atomic<node*> head; //!< the most recently added node
+        node* tail; //!< the placeholder node before the next element to extract
+    };
+
+    channel priorityChannel; //!< channel for priority elements
+    channel mainChannel; //!< channel for normal elements
+    std::atomic<bool> parked{false}; //!< indicator that the consumer is waiting on the condition
+    std::mutex parkLock; //!< mutex for the condition variable
+    std::condition_variable condition; //!< condition variable for notification of new data
+    int spinLimit{minSpinCount}; //!< the current number of checks before the consumer parks
+    static constexpr int minSpinCount{50}; //!< the smallest spin before parking
+    static constexpr int maxSpinCount{3200}; //!< the largest spin before parking
+
+  public:
+    MpscPriorityQueue() = default;
+    MpscPriorityQueue(const MpscPriorityQueue&) = delete;
+    MpscPriorityQueue& operator=(const MpscPriorityQueue&) = delete;
+
+    /** push an element onto the queue
+    @param val the value to push on the queue
+    */
+    template<class Z>
+    void push(Z&& val)
+    {
+        mainChannel.push(new node(std::forward<Z>(val)));
+        notify();
+    }
+    /** construct an element in place on the queue*/
+    template<class... Args>
+    void emplace(Args&&... args)
+    {
+        mainChannel.push(new node(std::forward<Args>(args)...));
+        notify();
+    }
+    /** push an element onto the priority channel, these are extracted before any normal elements*/
+    template<class Z>
+    void pushPriority(Z&& val)
+    {
+        priorityChannel.push(new node(std::forward<Z>(val)));
+        notify();
+    }
+    /** push a set of elements onto the queue with a single atomic operation and notification
+    @details the elements are extracted in the order of the vector*/
+    template<class Z>
+    void pushVector(const std::vector<Z>& vals)
+    {
+        if (vals.empty()) {
+            return;
+        }
+        node* first = new node(vals.front());
+        node* last = first;
+        for (auto it = vals.begin() + 1; it != vals.end(); ++it) {
+            node* newNode = new node(*it);
+            last->next.store(newNode, std::memory_order_relaxed);
+            last = newNode;
+        }
+        mainChannel.pushChain(first, last);
+        notify();
+    }
+    /** construct an element in place on the priority channel*/
+    template<class... Args>
+    void emplacePriority(Args&&... args)
+    {
+        priorityChannel.push(new node(std::forward<Args>(args)...));
+        notify();
+    }
+    /** try to extract an element from the queue,  only callable from the consumer thread
+    @return an optional containing the element if one was available*/
+    stx::optional<T> try_pop()
+    {
+        stx::optional<T> val;
+        if (!priorityChannel.try_pop(val)) {
+            mainChannel.try_pop(val);
+        }
+        return val;
+    }
+    /** extract an element from the queue, blocking until one is available
+    @details only callable from the consumer thread*/
+    T pop()
+    {
+        while (true) {
+            auto val = try_pop();
+            if (val) {
+                return std::move(*val);
+            }
+            int spins = 0;
+            while (empty() && spins < spinLimit) {
+                std::this_thread::yield();
+                ++spins;
+            }
+            if (!empty()) {
+                // a producer may have claimed a slot but not finished linking it so just try again
+                if (spins > spinLimit / 2 && spinLimit < maxSpinCount) {
+                    spinLimit *= 2;
+                }
+                continue;
+            }
+            if (spinLimit > minSpinCount) {
+                spinLimit /= 2;
+            }
+            std::unique_lock<std::mutex> lock(parkLock);
+            parked.store(true, std::memory_order_seq_cst);
+            condition.wait(lock, [this]() { return !empty(); });
+            parked.store(false, std::memory_order_relaxed);
+        }
+    }
+    /** remove all the elements from the queue,  only callable from the consumer thread*/
+    void clear()
+    {
+        while (try_pop()) {
+        }
+    }
+    /** check if the queue is empty
+    @details only callable from the consumer thread, it reads the tail of each channel which the
+    consumer owns*/
+    bool empty() const { return priorityChannel.empty() && mainChannel.empty(); }
+
+  private:
+    void notify()
+    {
+        if (parked.load(std::memory_order_seq_cst)) {
+            std::lock_guard<std::mutex> lock(parkLock);
+            condition.notify_one();
+        }
+    }
+};
+
+} // namespace helics
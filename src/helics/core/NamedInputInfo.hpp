@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "StringPool.hpp"
 #include "basic_core_types.hpp"
 
 #include <memory>
@@ -46,16 +47,24 @@ class NamedInputInfo {
         const std::string& type_,
         const std::string& units_):
         id(handle),
-        key(key_), type(type_), units(units_)
+        keyHandle(StringPool::intern(key_)), typeHandle(StringPool::intern(type_)),
+        unitsHandle(StringPool::intern(units_)), key(*keyHandle), type(*typeHandle),
+        units(*unitsHandle)
     {
     }
 
     const global_handle id; //!< identifier for the handle
-    const std::string key; //!< the identifier for the input
-    const std::string type; //! the nominal type of data for the input
+  private:
+    const StringPool::handle keyHandle; //!< the pool reference for the key
+    const StringPool::handle typeHandle; //!< the pool reference for the type
+    const StringPool::handle unitsHandle; //!< the pool reference for the units
+
+  public:
+    const std::string& key; //!< the identifier for the input (interned)
+    const std::string& type; //! the nominal type of data for the input (interned)
     std::string inputType; //!< the type of data that its first matching input uses
     std::string inputUnits; //!< the units of the data that its first matching input uses
-    const std::string units; //!< the units of the controlInput
+    const std::string& units; //!< the units of the controlInput (interned)
     bool required =
         false; //!< flag indicating that the subscription requires a matching publication
     bool optional = false; //!< flag indicating that any targets are optional
@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "StringPool.hpp"
 #include "global_federate_id.hpp"
 
 #include <cstdint>
@@ -23,14 +24,22 @@ class PublicationInfo {
         const std::string& ptype,
         const std::string& punits):
         id(pid),
-        key(pkey), type(ptype), units(punits)
+        keyHandle(StringPool::intern(pkey)), typeHandle(StringPool::intern(ptype)),
+        unitsHandle(StringPool::intern(punits)), key(*keyHandle), type(*typeHandle),
+        units(*unitsHandle)
     {
     }
     const global_handle id; //!< the identifier for the containing federate
+  private:
+    const StringPool::handle keyHandle; //!< the pool reference for the key
+    const StringPool::handle typeHandle; //!< the pool reference for the type
+    const StringPool::handle unitsHandle; //!< the pool reference for the units
+
+  public:
     std::vector<global_handle> subscribers; //!< container for all the subscribers of a publication
-    const std::string key; //!< the key identifier for the publication
-    const std::string type; //!< the type of the publication data
-    const std::string units; //!< the units of the publication data
+    const std::string& key; //!< the key identifier for the publication (interned)
+    const std::string& type; //!< the type of the publication data (interned)
+    const std::string& units; //!< the units of the publication data (interned)
     std::string data; //!< the most recent publication data
     bool has_update = false; //!< indicator that the publication has updates
     bool only_update_on_change = false;
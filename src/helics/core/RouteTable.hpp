@@ -0,0 +1,131 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "global_federate_id.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+namespace helics {
+/** table of the routes to federates and brokers
+@details global ids are handed out sequentially by the root broker so the routes are stored in vectors indexed
+directly by the id, which makes a lookup an index operation instead of a map search.  Ids outside the normal
+ranges are kept in a fallback map.
+*/
+class RouteTable {
+  public:
+    RouteTable() = default;
+    /** add a route for an id if one does not already exist
+    @return true if the route was added*/
+    bool addRoute(global_federate_id id, route_id rid)
+    {
+        auto* slot = getSlot(id, true);
+        if (slot == nullptr) {
+            return fallbackRoutes.emplace(id, rid).second;
+        }
+        if (slot->isValid()) {
+            return false;
+        }
+        *slot = rid;
+        return true;
+    }
+    /** set the route for an id overwriting any existing route*/
+    void setRoute(global_federate_id id, route_id rid)
+    {
+        auto* slot = getSlot(id, true);
+        if (slot == nullptr) {
+            fallbackRoutes[id] = rid;
+        } else {
+            *slot = rid;
+        }
+    }
+    /** remove the route for an id*/
+    void removeRoute(global_federate_id id)
+    {
+        auto* slot = getSlot(id, false);
+        if (slot == nullptr) {
+            fallbackRoutes.erase(id);
+        } else {
+            *slot = route_id{};
+        }
+    }
+    /** get the route for an id
+    @param id the global id to look up
+    @param defaultRoute the route to return if no route is known
+    */
+    route_id getRoute(global_federate_id id, route_id defaultRoute = parent_route_id) const
+    {
+        const route_id* slot{nullptr};
+        if (id.isFederate()) {
+            auto index = static_cast<std::size_t>(id.localIndex());
+            if (index < federateRoutes.size()) {
+                slot = &federateRoutes[index];
+            } else if (index < maxDenseIndex) {
+                return defaultRoute;
+            }
+        } else if (id.isBroker()) {
+            auto index = static_cast<std::size_t>(global_broker_id(id).localIndex());
+            if (index < brokerRoutes.size()) {
+                slot = &brokerRoutes[index];
+            } else if (index < maxDenseIndex) {
+                return defaultRoute;
+            }
+        }
+        if (slot != nullptr) {
+            return (slot->isValid()) ? *slot : defaultRoute;
+        }
+        if (fallbackRoutes.empty()) {
+            return defaultRoute;
+        }
+        auto fnd = fallbackRoutes.find(id);
+        return (fnd != fallbackRoutes.end()) ? fnd->second : defaultRoute;
+    }
+    /** check if a route exists for an id*/
+    bool hasRoute(global_federate_id id) const { return getRoute(id, route_id{}).isValid(); }
+    /** remove all the routes*/
+    void clear()
+    {
+        federateRoutes.clear();
+        brokerRoutes.clear();
+        fallbackRoutes.clear();
+    }
+
+  private:
+    /** get a pointer to the storage location of an id
+    @return nullptr if the id is not stored in the dense vectors*/
+    route_id* getSlot(global_federate_id id, bool expand)
+    {
+        std::vector<route_id>* routes{nullptr};
+        std::size_t index{0};
+        if (id.isFederate()) {
+            routes = &federateRoutes;
+            index = static_cast<std::size_t>(id.localIndex());
+        } else if (id.isBroker()) {
+            routes = &brokerRoutes;
+            index = static_cast<std::size_t>(global_broker_id(id).localIndex());
+        }
+        if (routes == nullptr || index >= maxDenseIndex) {
+            return nullptr;
+        }
+        if (index >= routes->size()) {
+            if (!expand) {
+                return nullptr;
+            }
+            routes->resize(index + 1);
+        }
+        return &((*routes)[index]);
+    }
+    /** the largest index stored in the vectors, ids larger than this would not be generated in normal use*/
+    static constexpr std::size_t maxDenseIndex{1U << 24U};
+    std::vector<route_id> federateRoutes; //!< routes to federates indexed by the federate index
+    std::vector<route_id> brokerRoutes; //!< routes to brokers indexed by the broker index
+    std::unordered_map<global_federate_id, route_id>
+        fallbackRoutes; //!< routes for ids outside the normal id ranges
+};
+
+} // namespace helics
@@ -0,0 +1,161 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "StringPool.hpp"
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace helics {
+namespace {
+    /** the storage for the process wide pool*/
+    class poolData {
+      public:
+        std::mutex lock; //!< protection for the data
+        std::vector<const std::string*> strings; //!< the interned strings by id
+        std::vector<std::int32_t> freeIds; //!< ids of released strings available for reuse
+        /// map from the strings to their id and a weak reference to the owning handle
+        string_ref_map<std::pair<std::int32_t, std::weak_ptr<const std::string>>> index;
+    };
+
+    poolData& getPool()
+    {
+        // this is intentionally leaked so handles can be released during static destruction
+        static auto* pool = new poolData;
+        return *pool;
+    }
+
+    /** get the number of bytes a string uses beyond the string object*/
+    std::size_t heapBytes(const std::string& str)
+    {
+        // short strings are stored in the string object itself
+        return (str.capacity() > std::string().capacity()) ? str.capacity() + 1 : 0;
+    }
+
+    /** remove an entry from the pool and make its id available*/
+    void removeLocked(
+        poolData& pool,
+        string_ref_map<std::pair<std::int32_t, std::weak_ptr<const std::string>>>::iterator entry)
+    {
+        pool.strings[entry->second.first] = nullptr;
+        pool.freeIds.push_back(entry->second.first);
+        pool.index.erase(entry);
+    }
+
+    /** find a live handle to a string
+    @details an entry whose last handle is being released is removed so a new one can be made*/
+    StringPool::handle findLocked(poolData& pool, const std::string& str)
+    {
+        auto fnd = pool.index.find(str);
+        if (fnd == pool.index.end()) {
+            return nullptr;
+        }
+        auto existing = fnd->second.second.lock();
+        if (!existing) {
+            removeLocked(pool, fnd);
+        }
+        return existing;
+    }
+
+    /** deleter for interned strings which removes them from the pool*/
+    class releaseString {
+      public:
+        void operator()(const std::string* str) const
+        {
+            auto& pool = getPool();
+            {
+                std::lock_guard<std::mutex> lock(pool.lock);
+                auto fnd = pool.index.find(*str);
+                // the entry may already have been replaced by a new copy of the same string
+                if (fnd != pool.index.end() && &(fnd->first.get()) == str) {
+                    removeLocked(pool, fnd);
+                }
+            }
+            delete str;
+        }
+    };
+} // namespace
+
+StringPool::handle StringPool::intern(const std::string& str)
+{
+    auto& pool = getPool();
+    {
+        std::lock_guard<std::mutex> lock(pool.lock);
+        auto existing = findLocked(pool, str);
+        if (existing) {
+            return existing;
+        }
+    }
+    // the new handle is constructed outside the lock since a failure would call the deleter
+    handle newString(new std::string(str), releaseString());
+    std::lock_guard<std::mutex> lock(pool.lock);
+    auto existing = findLocked(pool, str);
+    if (existing) {
+        // newString is released after the lock
+        return existing;
+    }
+    std::int32_t id;
+    if (pool.freeIds.empty()) {
+        id = static_cast<std::int32_t>(pool.strings.size());
+        pool.strings.push_back(newString.get());
+    } else {
+        id = pool.freeIds.back();
+        pool.freeIds.pop_back();
+        pool.strings[id] = newString.get();
+    }
+    pool.index.emplace(*newString, std::make_pair(id, std::weak_ptr<const std::string>(newString)));
+    return newString;
+}
+
+StringPool::handle StringPool::lookupKey(const std::string& str)
+{
+    // aliasing constructor with an empty owner, so there is no allocation or reference count
+    return handle(handle(), &str);
+}
+
+std::int32_t StringPool::getId(const std::string& str)
+{
+    auto& pool = getPool();
+    std::lock_guard<std::mutex> lock(pool.lock);
+    auto fnd = pool.index.find(str);
+    if (fnd == pool.index.end() || fnd->second.second.expired()) {
+        return -1;
+    }
+    return fnd->second.first;
+}
+
+stx::string_view StringPool::getString(std::int32_t id)
+{
+    auto& pool = getPool();
+    std::lock_guard<std::mutex> lock(pool.lock);
+    if (id < 0 || static_cast<std::size_t>(id) >= pool.strings.size() ||
+        pool.strings[id] == nullptr) {
+        return stx::string_view{};
+    }
+    return *pool.strings[id];
+}
+
+StringPool::memoryUsage StringPool::getMemoryUsage()
+{
+    auto& pool = getPool();
+    std::lock_guard<std::mutex> lock(pool.lock);
+    memoryUsage usage;
+    for (const auto& entry : pool.index) {
+        auto refs = static_cast<std::size_t>(entry.second.second.use_count());
+        if (refs == 0) {
+            continue;
+        }
+        auto size = sizeof(std::string) + heapBytes(entry.first.get());
+        ++usage.count;
+        usage.bytes += size;
+        usage.savedBytes += (refs - 1) * size;
+    }
+    return usage;
+}
+
+} // namespace helics
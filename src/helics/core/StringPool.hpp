@@ -0,0 +1,93 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "helics/external/string_view.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace helics {
+/** process wide table of interned strings
+@details interface names, types, and units are repeated in the handle managers and interface information
+structures of every core and broker in a process, interning them means only a single copy of each string is
+stored.  Interned strings are reference counted through the handles returned by intern and are
+removed from the pool when the last handle is released.
+*/
+class StringPool {
+  public:
+    /** shared reference to an interned string*/
+    using handle = std::shared_ptr<const std::string>;
+    /** summary of the memory used by the pool*/
+    struct memoryUsage {
+        std::size_t count{0}; //!< the number of unique strings
+        std::size_t bytes{0}; //!< the bytes used by the unique strings
+        std::size_t savedBytes{0}; //!< the bytes that would have been used for duplicate copies
+    };
+    /** get a handle to the interned copy of a string
+    @details the string remains in the pool as long as any handle to it exists*/
+    static handle intern(const std::string& str);
+    /** get a handle referring to a string without interning it
+    @details the handle does not own the string, it is intended for lookups in maps keyed by
+    handles*/
+    static handle lookupKey(const std::string& str);
+    /** get the id of an interned string
+    @details the id is stable as long as the string is held by a handle
+    @return the id or -1 if the string is not in the pool*/
+    static std::int32_t getId(const std::string& str);
+    /** get a view of the string with a given id
+    @return an empty view if the id is not valid*/
+    static stx::string_view getString(std::int32_t id);
+    /** get the current memory usage of the pool*/
+    static memoryUsage getMemoryUsage();
+};
+
+/** reference to a string that outlives the containers it is stored in such as an interned string*/
+using string_ref = std::reference_wrapper<const std::string>;
+
+/** hash function for maps keyed by references to strings*/
+struct string_ref_hash {
+    std::size_t operator()(const std::string& str) const { return std::hash<std::string>()(str); }
+};
+/** equality function for maps keyed by references to strings*/
+struct string_ref_equal {
+    bool operator()(const std::string& str1, const std::string& str2) const { return str1 == str2; }
+};
+/** unordered map keyed by string references
+@details lookups can be done with any string without a copy*/
+template<class V>
+using string_ref_map = std::unordered_map<string_ref, V, string_ref_hash, string_ref_equal>;
+/** unordered multimap keyed by string references*/
+template<class V>
+using string_ref_multimap =
+    std::unordered_multimap<string_ref, V, string_ref_hash, string_ref_equal>;
+
+/** hash function for maps keyed by string pool handles*/
+struct string_handle_hash {
+    std::size_t operator()(const StringPool::handle& str) const
+    {
+        return std::hash<std::string>()(*str);
+    }
+};
+/** equality function for maps keyed by string pool handles*/
+struct string_handle_equal {
+    bool operator()(const StringPool::handle& str1, const StringPool::handle& str2) const
+    {
+        return *str1 == *str2;
+    }
+};
+/** unordered multimap keyed by string pool handles
+@details the keys hold their strings in the pool,  use StringPool::lookupKey for lookups*/
+template<class V>
+using string_handle_multimap =
+    std::unordered_multimap<StringPool::handle, V, string_handle_hash, string_handle_equal>;
+
+} // namespace helics
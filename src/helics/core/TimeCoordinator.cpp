@@ -340,26 +340,15 @@ void TimeCoordinator::updateMessageTime(Time messageUpdateTime)
 
 bool TimeCoordinator::updateTimeFactors()
 {
-    Time minNext = Time::maxVal();
+    Time minNext = dependencies.getMinNext();
     Time minminDe = std::min(time_value, time_message);
-    Time minDe = minminDe;
-    for (auto& dep : dependencies) {
-        if (dep.Tnext < minNext) {
-            minNext = dep.Tnext;
-        }
-        if (dep.Tdemin >= dep.Tnext) {
-            if (dep.Tdemin < minminDe) {
-                minminDe = dep.Tdemin;
-            }
-        } else {
-            // this minimum dependent event time received was invalid and can't be trusted
-            // therefore it can't be used to determine a time grant
-            minminDe = -1;
-        }
-
-        if (dep.Te < minDe) {
-            minDe = dep.Te;
-        }
+    Time minDe = std::min(minminDe, dependencies.getMinEvent());
+    if (dependencies.hasInvalidDependentEvents()) {
+        // a minimum dependent event time received was invalid and can't be trusted
+        // therefore it can't be used to determine a time grant
+        minminDe = -1;
+    } else {
+        minminDe = std::min(minminDe, dependencies.getMinDependentEvent());
     }
 
     bool update = false;
@@ -552,7 +541,7 @@ void TimeCoordinator::removeDependent(global_federate_id fedID)
     }
 }
 
-DependencyInfo* TimeCoordinator::getDependencyInfo(global_federate_id ofed)
+const DependencyInfo* TimeCoordinator::getDependencyInfo(global_federate_id ofed) const
 {
     return dependencies.getDependencyInfo(ofed);
 }
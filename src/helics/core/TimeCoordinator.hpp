@@ -143,7 +143,7 @@ class TimeCoordinator {
     /** take a global id and get a pointer to the dependencyInfo for the other fed
     will be nullptr if it doesn't exist
     */
-    DependencyInfo* getDependencyInfo(global_federate_id ofed);
+    const DependencyInfo* getDependencyInfo(global_federate_id ofed) const;
     /** check whether a federate is a dependency*/
     bool isDependency(global_federate_id ofed) const;
 
@@ -114,6 +114,110 @@ bool DependencyInfo::ProcessMessage(const ActionMessage& m)
     return true;
 }
 
+void TimeDependencies::dependencyHeap::rebuild(const std::vector<DependencyInfo>& deps)
+{
+    heap.resize(deps.size());
+    position.resize(deps.size());
+    for (std::size_t ii = 0; ii < deps.size(); ++ii) {
+        place(ii, static_cast<std::int32_t>(ii));
+    }
+    for (std::size_t ii = heap.size() / 2; ii > 0; --ii) {
+        siftDown(deps, ii - 1);
+    }
+}
+
+void TimeDependencies::dependencyHeap::update(
+    const std::vector<DependencyInfo>& deps,
+    std::int32_t index)
+{
+    auto pos = position[static_cast<std::size_t>(index)];
+    if (pos > 0 && less(deps, index, heap[(pos - 1) / 2])) {
+        siftUp(deps, pos);
+    } else {
+        siftDown(deps, pos);
+    }
+}
+
+bool TimeDependencies::dependencyHeap::topIsUnique(const std::vector<DependencyInfo>& deps) const
+{
+    // the second smallest element of a heap is always one of the children of the root
+    auto topTime = key(deps[static_cast<std::size_t>(heap.front())]).first;
+    for (std::size_t ii = 1; ii <= 2 && ii < heap.size(); ++ii) {
+        if (key(deps[static_cast<std::size_t>(heap[ii])]).first == topTime) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TimeDependencies::dependencyHeap::less(
+    const std::vector<DependencyInfo>& deps,
+    std::int32_t a,
+    std::int32_t b) const
+{
+    auto keyA = key(deps[static_cast<std::size_t>(a)]);
+    auto keyB = key(deps[static_cast<std::size_t>(b)]);
+    return (keyA < keyB) || ((keyA == keyB) && (a < b));
+}
+
+void TimeDependencies::dependencyHeap::siftUp(const std::vector<DependencyInfo>& deps, std::size_t pos)
+{
+    auto index = heap[pos];
+    while (pos > 0) {
+        auto parent = (pos - 1) / 2;
+        if (!less(deps, index, heap[parent])) {
+            break;
+        }
+        place(pos, heap[parent]);
+        pos = parent;
+    }
+    place(pos, index);
+}
+
+void TimeDependencies::dependencyHeap::siftDown(
+    const std::vector<DependencyInfo>& deps,
+    std::size_t pos)
+{
+    auto index = heap[pos];
+    while (true) {
+        auto child = 2 * pos + 1;
+        if (child >= heap.size()) {
+            break;
+        }
+        if (child + 1 < heap.size() && less(deps, heap[child + 1], heap[child])) {
+            ++child;
+        }
+        if (!less(deps, heap[child], index)) {
+            break;
+        }
+        place(pos, heap[child]);
+        pos = child;
+    }
+    place(pos, index);
+}
+
+TimeDependencies::TimeDependencies():
+    nextHeap([](const DependencyInfo& dep) {
+        // granted dependencies sort ahead of others with the same time
+        return std::make_pair(
+            dep.Tnext, (dep.time_state == DependencyInfo::time_state_t::time_granted) ? 0 : 1);
+    }),
+    eventHeap([](const DependencyInfo& dep) { return std::make_pair(dep.Te, 0); }),
+    minEventHeap([](const DependencyInfo& dep) { return std::make_pair(dep.Tdemin, 0); })
+{
+}
+
+void TimeDependencies::rebuildHeaps()
+{
+    nextHeap.rebuild(dependencies);
+    eventHeap.rebuild(dependencies);
+    minEventHeap.rebuild(dependencies);
+    invalidMinEvents = static_cast<int>(
+        std::count_if(dependencies.begin(), dependencies.end(), [](const auto& dep) {
+            return dep.Tdemin < dep.Tnext;
+        }));
+}
+
 // comparison helper lambda for comparing dependencies
 static auto dependencyCompare = [](const auto& dep, auto& target) { return (dep.fedID < target); };
 
@@ -136,21 +240,12 @@ const DependencyInfo* TimeDependencies::getDependencyInfo(global_federate_id id)
     return &(*res);
 }
 
-DependencyInfo* TimeDependencies::getDependencyInfo(global_federate_id id)
-{
-    auto res = std::lower_bound(dependencies.begin(), dependencies.end(), id, dependencyCompare);
-    if ((res == dependencies.end()) || (res->fedID != id)) {
-        return nullptr;
-    }
-
-    return &(*res);
-}
-
 bool TimeDependencies::addDependency(global_federate_id id)
 
 {
     if (dependencies.empty()) {
         dependencies.emplace_back(id);
+        rebuildHeaps();
         return true;
     }
     auto dep = std::lower_bound(dependencies.begin(), dependencies.end(), id, dependencyCompare);
@@ -163,6 +258,8 @@ bool TimeDependencies::addDependency(global_federate_id id)
         }
         dependencies.emplace(dep, id);
     }
+    // the indices after the insertion point have shifted
+    rebuildHeaps();
     return true;
 }
 
@@ -172,6 +269,7 @@ void TimeDependencies::removeDependency(global_federate_id id)
     if (dep != dependencies.end()) {
         if (dep->fedID == id) {
             dependencies.erase(dep);
+            rebuildHeaps();
         }
     }
 }
@@ -180,11 +278,71 @@ bool TimeDependencies::updateTime(const ActionMessage& m)
 {
     auto dependency_id = (m.action() != CMD_SEND_MESSAGE) ? m.source_id : m.dest_id;
 
-    auto depInfo = getDependencyInfo(global_federate_id(dependency_id));
-    if (depInfo == nullptr) {
+    auto res = std::lower_bound(
+        dependencies.begin(), dependencies.end(), global_federate_id(dependency_id), dependencyCompare);
+    if ((res == dependencies.end()) || (res->fedID != dependency_id)) {
         return false;
     }
-    return depInfo->ProcessMessage(m);
+    auto& depInfo = *res;
+    bool wasInvalid = depInfo.Tdemin < depInfo.Tnext;
+    auto prevState = depInfo.time_state;
+    auto prevNext = depInfo.Tnext;
+    auto prevEvent = depInfo.Te;
+    auto prevMinEvent = depInfo.Tdemin;
+    bool updated = depInfo.ProcessMessage(m);
+
+    auto index = static_cast<std::int32_t>(res - dependencies.begin());
+    if (prevNext != depInfo.Tnext || prevState != depInfo.time_state) {
+        nextHeap.update(dependencies, index);
+    }
+    if (prevEvent != depInfo.Te) {
+        eventHeap.update(dependencies, index);
+    }
+    if (prevMinEvent != depInfo.Tdemin) {
+        minEventHeap.update(dependencies, index);
+    }
+    bool isInvalid = depInfo.Tdemin < depInfo.Tnext;
+    if (isInvalid != wasInvalid) {
+        invalidMinEvents += (isInvalid) ? 1 : -1;
+    }
+    return updated;
+}
+
+const DependencyInfo* TimeDependencies::getMinNextDependency() const
+{
+    auto index = nextHeap.top();
+    return (index >= 0) ? &dependencies[static_cast<std::size_t>(index)] : nullptr;
+}
+
+Time TimeDependencies::getMinNext() const
+{
+    auto index = nextHeap.top();
+    return (index >= 0) ? dependencies[static_cast<std::size_t>(index)].Tnext : Time::maxVal();
+}
+
+Time TimeDependencies::getMinEvent() const
+{
+    auto index = eventHeap.top();
+    return (index >= 0) ? dependencies[static_cast<std::size_t>(index)].Te : Time::maxVal();
+}
+
+Time TimeDependencies::getMinDependentEvent() const
+{
+    auto index = minEventHeap.top();
+    return (index >= 0) ? dependencies[static_cast<std::size_t>(index)].Tdemin : Time::maxVal();
+}
+
+global_federate_id TimeDependencies::getMinDependentEventFederate() const
+{
+    auto index = minEventHeap.top();
+    if (index < 0) {
+        return global_federate_id{};
+    }
+    const auto& dep = dependencies[static_cast<std::size_t>(index)];
+    if (dep.Tdemin == Time::maxVal() || !minEventHeap.topIsUnique(dependencies)) {
+        return global_federate_id{};
+    }
+    return dep.fedID;
 }
 
 bool TimeDependencies::checkIfReadyForExecEntry(bool iterating) const
@@ -215,31 +373,19 @@ void TimeDependencies::resetIteratingExecRequests()
     }
 }
 
-bool TimeDependencies::checkIfReadyForTimeGrant(bool iterating, Time desiredGrantTime) const
+bool TimeDependencies::checkIfReadyForTimeGrant(bool /*iterating*/, Time desiredGrantTime) const
 {
-    if (iterating) {
-        for (auto& dep : dependencies) {
-            if (dep.Tnext < desiredGrantTime) {
-                return false;
-            }
-            if ((dep.Tnext == desiredGrantTime) &&
-                (dep.time_state == DependencyInfo::time_state_t::time_granted)) {
-                return false;
-            }
-        }
-    } else {
-        for (auto& dep : dependencies) {
-            if (dep.Tnext < desiredGrantTime) {
-                return false;
-            }
-            if (dep.Tnext == desiredGrantTime) {
-                if (dep.time_state == DependencyInfo::time_state_t::time_granted) {
-                    return false;
-                }
-            }
-        }
+    // the minimum dependency is a granted one if any granted dependency shares the minimum time
+    const auto* dep = getMinNextDependency();
+    if (dep == nullptr) {
+        return true;
     }
-    return true;
+    if (dep->Tnext < desiredGrantTime) {
+        return false;
+    }
+    return !(
+        (dep->Tnext == desiredGrantTime) &&
+        (dep->time_state == DependencyInfo::time_state_t::time_granted));
 }
 
 void TimeDependencies::resetIteratingTimeRequests(helics::Time requestTime)
@@ -253,6 +399,7 @@ void TimeDependencies::resetIteratingTimeRequests(helics::Time requestTime)
             }
         }
     }
+    rebuildHeaps();
 }
 
 void TimeDependencies::resetDependentEvents(helics::Time grantTime)
@@ -261,6 +408,7 @@ void TimeDependencies::resetDependentEvents(helics::Time grantTime)
         dep.Te = (std::max)(dep.Tnext, grantTime);
         dep.Tdemin = dep.Te;
     }
+    rebuildHeaps();
 }
 
 } // namespace helics
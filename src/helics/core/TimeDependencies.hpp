@@ -8,6 +8,8 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "basic_core_types.hpp"
 
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace helics {
@@ -48,13 +50,55 @@ class DependencyInfo {
     bool ProcessMessage(const ActionMessage& m);
 };
 
-/** class for managing a set of dependencies*/
+/** class for managing a set of dependencies
+@details the dependencies are kept sorted by id.  The minimum times over all the dependencies are tracked in indexed
+heaps which are updated as each time message is processed, so the minimums are available without scanning all the
+dependencies
+*/
 class TimeDependencies {
   private:
+    /** min heap of dependency indices ordered by one of the time fields
+    @details the position of each dependency in the heap is stored so a single entry can be moved when its time
+    changes*/
+    class dependencyHeap {
+      public:
+        /** the ordering key of a dependency,  ties are broken by the dependency index*/
+        using keyFunction = std::pair<Time, int> (*)(const DependencyInfo& dep);
+        explicit dependencyHeap(keyFunction keyFunc): key(keyFunc) {}
+        /** regenerate the heap from all the dependencies*/
+        void rebuild(const std::vector<DependencyInfo>& deps);
+        /** restore the heap order after the time of a single dependency changed*/
+        void update(const std::vector<DependencyInfo>& deps, std::int32_t index);
+        /** get the index of the dependency with the minimum key or -1 if there are no dependencies*/
+        std::int32_t top() const { return heap.empty() ? -1 : heap.front(); }
+        /** check if no other dependency has the same time as the minimum*/
+        bool topIsUnique(const std::vector<DependencyInfo>& deps) const;
+
+      private:
+        bool less(const std::vector<DependencyInfo>& deps, std::int32_t a, std::int32_t b) const;
+        void siftUp(const std::vector<DependencyInfo>& deps, std::size_t pos);
+        void siftDown(const std::vector<DependencyInfo>& deps, std::size_t pos);
+        void place(std::size_t pos, std::int32_t index)
+        {
+            heap[pos] = index;
+            position[static_cast<std::size_t>(index)] = pos;
+        }
+        keyFunction key; //!< the function generating the ordering key
+        std::vector<std::int32_t> heap; //!< the dependency indices in heap order
+        std::vector<std::size_t> position; //!< the location of each dependency index in the heap
+    };
+
     std::vector<DependencyInfo> dependencies; //!< container
+    dependencyHeap nextHeap; //!< heap ordered by Tnext, granted dependencies first on equal times
+    dependencyHeap eventHeap; //!< heap ordered by Te
+    dependencyHeap minEventHeap; //!< heap ordered by Tdemin
+    int invalidMinEvents{0}; //!< the number of dependencies with Tdemin<Tnext
+    /** regenerate all the heaps*/
+    void rebuildHeaps();
+
   public:
     /** default constructor*/
-    TimeDependencies() = default;
+    TimeDependencies();
     /** return true if the given federate is already a member*/
     bool isDependency(global_federate_id ofed) const;
     /** insert a dependency into the structure
@@ -67,10 +111,6 @@ class TimeDependencies {
     bool updateTime(const ActionMessage& m);
     /** get the number of dependencies*/
     auto size() const { return dependencies.size(); }
-    /** iterator to first dependency*/
-    auto begin() { return dependencies.begin(); }
-    /** iterator to end point*/
-    auto end() { return dependencies.end(); }
     /**  const iterator to first dependency*/
     auto begin() const { return dependencies.cbegin(); }
     /** const iterator to end point*/
@@ -83,8 +123,22 @@ class TimeDependencies {
     /** get a pointer to the dependency information for a particular object*/
     const DependencyInfo* getDependencyInfo(global_federate_id id) const;
 
-    /** get a pointer to the dependency information for a particular object*/
-    DependencyInfo* getDependencyInfo(global_federate_id id);
+    /** get the dependency with the minimum Tnext
+    @details if several dependencies share the minimum a granted one is returned if present, otherwise the one
+    with the lowest id
+    @return nullptr if there are no dependencies*/
+    const DependencyInfo* getMinNextDependency() const;
+    /** get the minimum Tnext of the dependencies, Time::maxVal() if there are none*/
+    Time getMinNext() const;
+    /** get the minimum Te of the dependencies, Time::maxVal() if there are none*/
+    Time getMinEvent() const;
+    /** get the minimum Tdemin of the dependencies, Time::maxVal() if there are none*/
+    Time getMinDependentEvent() const;
+    /** get the id of the dependency with the minimum Tdemin
+    @return an invalid id if the minimum is shared by several dependencies or there are no events*/
+    global_federate_id getMinDependentEventFederate() const;
+    /** check if any dependency has a Tdemin less than its Tnext, which means its Tdemin can't be trusted*/
+    bool hasInvalidDependentEvents() const { return invalidMinEvents > 0; }
 
     /** check if the dependencies would allow entry to exec mode*/
     bool checkIfReadyForExecEntry(bool iterating) const;
@@ -15,7 +15,7 @@ void UnknownHandleManager::addUnknownPublication(
     global_handle target,
     uint16_t flags)
 {
-    unknown_publications.emplace(key, std::make_pair(target, flags));
+    unknown_publications.emplace(StringPool::intern(key), std::make_pair(target, flags));
 }
 /** add a missingPublication*/
 void UnknownHandleManager::addUnknownInput(
@@ -23,7 +23,7 @@ void UnknownHandleManager::addUnknownInput(
     global_handle target,
     uint16_t flags)
 {
-    unknown_inputs.emplace(key, std::make_pair(target, flags));
+    unknown_inputs.emplace(StringPool::intern(key), std::make_pair(target, flags));
 }
 
 /** add a missing destination endpoint*/
@@ -32,7 +32,7 @@ void UnknownHandleManager::addUnknownEndpoint(
     global_handle target,
     uint16_t flags)
 {
-    unknown_endpoints.emplace(key, std::make_pair(target, flags));
+    unknown_endpoints.emplace(StringPool::intern(key), std::make_pair(target, flags));
 }
 /** add a missing filter*/
 void UnknownHandleManager::addUnknownFilter(
@@ -40,34 +40,34 @@ void UnknownHandleManager::addUnknownFilter(
     global_handle target,
     uint16_t flags)
 {
-    unknown_filters.emplace(key, std::make_pair(target, flags));
+    unknown_filters.emplace(StringPool::intern(key), std::make_pair(target, flags));
 }
 
 void UnknownHandleManager::addDataLink(const std::string& source, const std::string& target)
 {
-    unknown_links.emplace(source, target);
+    unknown_links.emplace(StringPool::intern(source), StringPool::intern(target));
 }
 
 void UnknownHandleManager::addSourceFilterLink(
     const std::string& filter,
     const std::string& endpoint)
 {
-    unknown_src_filters.emplace(filter, endpoint);
+    unknown_src_filters.emplace(StringPool::intern(filter), StringPool::intern(endpoint));
 }
 
 void UnknownHandleManager::addDestinationFilterLink(
     const std::string& filter,
     const std::string& endpoint)
 {
-    unknown_dest_filters.emplace(filter, endpoint);
+    unknown_dest_filters.emplace(StringPool::intern(filter), StringPool::intern(endpoint));
 }
 
 static auto getTargets(
-    const std::unordered_multimap<std::string, UnknownHandleManager::targetInfo>& tmap,
+    const string_handle_multimap<UnknownHandleManager::targetInfo>& tmap,
     const std::string& target)
 {
     std::vector<UnknownHandleManager::targetInfo> targets;
-    auto rp = tmap.equal_range(target);
+    auto rp = tmap.equal_range(StringPool::lookupKey(target));
     if (rp.first != tmap.end()) {
         auto it = rp.first;
         while (it != rp.second) {
@@ -79,15 +79,15 @@ static auto getTargets(
 }
 
 static auto getTargets(
-    const std::unordered_multimap<std::string, std::string>& tmap,
+    const string_handle_multimap<StringPool::handle>& tmap,
     const std::string& target)
 {
     std::vector<std::string> targets;
-    auto rp = tmap.equal_range(target);
+    auto rp = tmap.equal_range(StringPool::lookupKey(target));
     if (rp.first != tmap.end()) {
         auto it = rp.first;
         while (it != rp.second) {
-            targets.push_back(it->second);
+            targets.push_back(*it->second);
             ++it;
         }
     }
@@ -212,26 +212,26 @@ void UnknownHandleManager::processNonOptionalUnknowns(
         if ((upub.second.second & make_flags(optional_flag)) != 0) {
             continue;
         }
-        cfunc(upub.first, 'p', upub.second.first);
+        cfunc(*upub.first, 'p', upub.second.first);
     }
     for (auto& uept : unknown_endpoints) {
         if ((uept.second.second & make_flags(optional_flag)) != 0) {
             continue;
         }
-        cfunc(uept.first, 'e', uept.second.first);
+        cfunc(*uept.first, 'e', uept.second.first);
     }
     for (auto& uinp : unknown_inputs) {
         if ((uinp.second.second & make_flags(optional_flag)) != 0) {
             continue;
         }
-        cfunc(uinp.first, 'i', uinp.second.first);
+        cfunc(*uinp.first, 'i', uinp.second.first);
     }
 
     for (auto& ufilt : unknown_filters) {
         if ((ufilt.second.second & make_flags(optional_flag)) != 0) {
             continue;
         }
-        cfunc(ufilt.first, 'f', ufilt.second.first);
+        cfunc(*ufilt.first, 'f', ufilt.second.first);
     }
 }
 
@@ -240,23 +240,23 @@ void UnknownHandleManager::processRequiredUnknowns(
 {
     for (auto& upub : unknown_publications) {
         if ((upub.second.second & make_flags(required_flag)) != 0) {
-            cfunc(upub.first, 'p', upub.second.first);
+            cfunc(*upub.first, 'p', upub.second.first);
         }
     }
     for (auto& uept : unknown_endpoints) {
         if ((uept.second.second & make_flags(required_flag)) != 0) {
-            cfunc(uept.first, 'e', uept.second.first);
+            cfunc(*uept.first, 'e', uept.second.first);
         }
     }
     for (auto& uinp : unknown_inputs) {
         if ((uinp.second.second & make_flags(required_flag)) != 0) {
-            cfunc(uinp.first, 'i', uinp.second.first);
+            cfunc(*uinp.first, 'i', uinp.second.first);
         }
     }
 
     for (auto& ufilt : unknown_filters) {
         if ((ufilt.second.second & make_flags(required_flag)) != 0) {
-            cfunc(ufilt.first, 'f', ufilt.second.first);
+            cfunc(*ufilt.first, 'f', ufilt.second.first);
         }
     }
 }
@@ -264,27 +264,27 @@ void UnknownHandleManager::processRequiredUnknowns(
 /** specify a found input*/
 void UnknownHandleManager::clearInput(const std::string& newInput)
 {
-    unknown_inputs.erase(newInput);
+    unknown_inputs.erase(StringPool::lookupKey(newInput));
 }
 
 /** specify a found input*/
 void UnknownHandleManager::clearPublication(const std::string& newPublication)
 {
-    unknown_publications.erase(newPublication);
-    unknown_links.erase(newPublication);
+    unknown_publications.erase(StringPool::lookupKey(newPublication));
+    unknown_links.erase(StringPool::lookupKey(newPublication));
 }
 /** specify a found input*/
 void UnknownHandleManager::clearEndpoint(const std::string& newEndpoint)
 {
-    unknown_endpoints.erase(newEndpoint);
+    unknown_endpoints.erase(StringPool::lookupKey(newEndpoint));
 }
 
 /** specify a found input*/
 void UnknownHandleManager::clearFilter(const std::string& newFilter)
 {
-    unknown_filters.erase(newFilter);
-    unknown_src_filters.erase(newFilter);
-    unknown_dest_filters.erase(newFilter);
+    unknown_filters.erase(StringPool::lookupKey(newFilter));
+    unknown_src_filters.erase(StringPool::lookupKey(newFilter));
+    unknown_dest_filters.erase(StringPool::lookupKey(newFilter));
 }
 
 void UnknownHandleManager::clearFederateUnknowns(global_federate_id id)
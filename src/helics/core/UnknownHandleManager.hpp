@@ -5,6 +5,7 @@ the top-level NOTICE for additional details. All rights reserved.
 SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
+#include "StringPool.hpp"
 #include "global_federate_id.hpp"
 
 #include <string>
@@ -21,19 +22,17 @@ class UnknownHandleManager {
     using targetInfo = std::pair<global_handle, uint16_t>;
 
   private:
-    std::unordered_multimap<std::string, targetInfo>
+    // the keys and link targets are interned strings
+    string_handle_multimap<targetInfo>
         unknown_publications; //!< map of all unknown publications
-    std::unordered_multimap<std::string, targetInfo>
-        unknown_endpoints; //!< map of all unknown endpoints
-    std::unordered_multimap<std::string, targetInfo>
-        unknown_inputs; //!< map of all unknown endpoints
-    std::unordered_multimap<std::string, targetInfo>
-        unknown_filters; //!< map of all unknown filters
-    std::unordered_multimap<std::string, std::string>
+    string_handle_multimap<targetInfo> unknown_endpoints; //!< map of all unknown endpoints
+    string_handle_multimap<targetInfo> unknown_inputs; //!< map of all unknown endpoints
+    string_handle_multimap<targetInfo> unknown_filters; //!< map of all unknown filters
+    string_handle_multimap<StringPool::handle>
         unknown_links; //!< map where links on either side is not known
-    std::unordered_multimap<std::string, std::string>
+    string_handle_multimap<StringPool::handle>
         unknown_src_filters; //!< map connecting source filters to endpoints
-    std::unordered_multimap<std::string, std::string>
+    string_handle_multimap<StringPool::handle>
         unknown_dest_filters; //!< map connecting destination filters to endpoints
   public:
     /** default constructor*/
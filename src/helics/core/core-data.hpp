@@ -180,6 +180,20 @@ class Message {
     const std::string& to_string() const { return data.to_string(); }
 };
 
+/** a view of the fields of a message held in another object
+@details used by filter operators that modify a message in place without constructing a Message
+object,  the view is only valid as long as the object it was created from*/
+class MessageView {
+  public:
+    Time& time; //!< the event time the message is sent
+    std::int32_t& messageID; //!< the messageID for a message
+    std::string& data; //!< the data packet for the message
+    std::string& dest; //!< the destination of the message
+    std::string& original_dest; //!< the original destination of a message
+    const std::string& source; //!< the most recent source of the message
+    const std::string& original_source; //!< the original source of the message
+};
+
 /**
  * FilterOperator abstract class
  @details FilterOperators will transform a message in some way in a direct fashion
@@ -203,6 +217,20 @@ class FilterOperator {
         }
         return ret;
     }
+    /** check if the operator can filter a message in place through processInPlace
+    @details operators returning true for a cloning filter must implement getCloneDestinations*/
+    virtual bool isInPlace() const { return false; }
+    /** filter a message in place
+    @return false if the message should be dropped*/
+    virtual bool processInPlace(MessageView& /*message*/) { return true; }
+    /** get the destinations a cloning filter sends copies of a message to
+    @param message the message to copy
+    @param destinations the container to append the destinations to*/
+    virtual void getCloneDestinations(
+        const MessageView& /*message*/,
+        std::vector<std::string>& /*destinations*/)
+    {
+    }
     /** make the operator work like one
     @details calls the process function*/
     std::unique_ptr<Message> operator()(std::unique_ptr<Message> message)
@@ -221,6 +249,7 @@ class NullFilterOperator final: public FilterOperator {
     {
         return message;
     }
+    virtual bool isInPlace() const override { return true; }
 };
 
 /** helper template to check whether an index is actually valid for a particular vector
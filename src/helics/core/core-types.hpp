@@ -43,6 +43,7 @@ enum class core_type : int {
     TCP_SS =
         helics_core_type_tcp_ss, //!< a single socket version of the TCP core for more easily handling firewalls
     UDP = helics_core_type_udp, //!< use UDP packets to send the data
+    SHM = helics_core_type_shm, //!< use lock free rings in shared memory on the same machine
     NNG = helics_core_type_nng, //!< reserved for future Nanomsg implementation
     ZMQ_SS =
         helics_core_type_zmq_test, //!< single socket version of ZMQ core for better scalability performance
@@ -40,6 +40,8 @@ namespace core {
                 return "http_";
             case core_type::UDP:
                 return "udp_";
+            case core_type::SHM:
+                return "shm_";
             case core_type::NNG:
                 return "nng_";
             case core_type::INPROC:
@@ -75,6 +77,10 @@ namespace core {
         {"ipc", core_type::INTERPROCESS},
         {"interproc", core_type::INTERPROCESS},
         {"IPC", core_type::INTERPROCESS},
+        {"shm", core_type::SHM},
+        {"SHM", core_type::SHM},
+        {"sharedmem", core_type::SHM},
+        {"shared_memory", core_type::SHM},
         {"tcp", core_type::TCP},
         {"tcpip", core_type::TCP},
         {"TCP", core_type::TCP},
@@ -134,6 +140,9 @@ namespace core {
         if (type.compare(0, 3, "ipc") == 0) {
             return core_type::INTERPROCESS;
         }
+        if (type.compare(0, 3, "shm") == 0) {
+            return core_type::SHM;
+        }
         if (type.compare(0, 4, "test") == 0) {
             return core_type::TEST;
         }
@@ -194,6 +203,12 @@ namespace core {
     static bool constexpr ipc_availability{true};
 #endif
 
+#ifndef ENABLE_SHM_CORE
+    static bool constexpr shm_availability{false};
+#else
+    static bool constexpr shm_availability{true};
+#endif
+
 #ifndef ENABLE_TEST_CORE
     static bool constexpr test_availability{false};
 #else
@@ -225,6 +240,9 @@ namespace core {
             case core_type::IPC:
                 available = ipc_availability;
                 break;
+            case core_type::SHM:
+                available = shm_availability;
+                break;
             case core_type::UDP:
                 available = udp_availability;
                 break;
@@ -33,6 +33,11 @@ enum operation_flags : uint16_t {
 
 constexpr uint16_t slow_responding_flag =
     14; //overload of extra_flag4 indicating a federate, core or broker is slow responding
+/** overload of extra_flag3 indicating support for the compact encoding in connection messages
+@details only valid on CMD_PROTOCOL and CMD_PROTOCOL_PRIORITY messages with the messageID
+REQUEST_PORTS, QUERY_PORTS or CONNECTION_REQUEST (the requests) or PORT_DEFINITIONS or
+CONNECTION_ACK (the replies), extra_flag3 has other meanings on other commands*/
+constexpr uint16_t compact_encoding_flag = 13;
 
 /** template function to set a flag in an object containing a flags field
 @tparam FlagContainer an object with a .flags field
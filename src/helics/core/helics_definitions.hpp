@@ -28,6 +28,9 @@ namespace defs {
         If the federate goes offline there is no good way to detect it so use with caution
         */
         slow_responding = helics_flag_slow_responding,
+        /** flag specifying that a federate should spin polling for messages instead of sleeping
+        while waiting on time grants and mode changes*/
+        busy_poll = helics_flag_busy_poll,
         /** flag specifying that a federate encountering an internal error should cause and abort for the entire co-simulation
         */
         terminate_on_error = helics_flag_terminate_on_error,
@@ -105,7 +108,8 @@ namespace defs {
         max_iterations = helics_property_int_max_iterations,
         log_level = helics_property_int_log_level,
         file_log_level = helics_property_int_file_log_level,
-        console_log_level = helics_property_int_console_log_level
+        console_log_level = helics_property_int_console_log_level,
+        busy_poll_budget = helics_property_int_busy_poll_budget
     };
 
     /** options for handles */
@@ -364,6 +364,50 @@ class ValueFederate: public virtual Federate {
     {
         helicsFederatePublishJSON(fed, json.c_str(), hThrowOnError());
     }
+    /** publish double values on several publications in a single operation
+    @param pubs the publications to publish on
+    @param vals the values to publish,  one for each publication*/
+    void publishBatch(const std::vector<Publication>& pubs, const std::vector<double>& vals)
+    {
+        if (pubs.size() != vals.size()) {
+            throw(HelicsException(
+                helics_error_invalid_argument,
+                "the number of values does not match the number of publications"));
+        }
+        if (pubs.empty()) {
+            return;
+        }
+        std::vector<helics_publication> handles(pubs.size());
+        for (size_t ii = 0; ii < pubs.size(); ++ii) {
+            handles[ii] = pubs[ii].baseObject();
+        }
+        helicsFederatePublishBatchDouble(
+            fed, &handles[0], &vals[0], static_cast<int>(vals.size()), hThrowOnError());
+    }
+    /** get the double values of several inputs in a single operation
+    @param inputs the inputs to get the values of
+    @param[out] vals the values of the inputs,  one for each input
+    @return a bitmask with bit ii%64 of element ii/64 set if input ii was updated*/
+    std::vector<uint64_t> getValueBatch(const std::vector<Input>& inputs, std::vector<double>& vals)
+    {
+        vals.resize(inputs.size());
+        std::vector<uint64_t> updated((inputs.size() + 63) / 64, 0);
+        if (inputs.empty()) {
+            return updated;
+        }
+        std::vector<helics_input> handles(inputs.size());
+        for (size_t ii = 0; ii < inputs.size(); ++ii) {
+            handles[ii] = inputs[ii].baseObject();
+        }
+        helicsFederateGetBatchDouble(
+            fed,
+            &handles[0],
+            &vals[0],
+            &updated[0],
+            static_cast<int>(inputs.size()),
+            hThrowOnError());
+        return updated;
+    }
 
   private:
     // Utility function for converting numbers to string
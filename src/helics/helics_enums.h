@@ -33,6 +33,9 @@ typedef enum {
     helics_core_type_ipc = 5,
     helics_core_type_tcp = 6, /*!< use a generic TCP protocol message stream to send messages */
     helics_core_type_udp = 7, /*!< use UDP packets to send the data */
+    /** use lock free rings in shared memory to transfer data between processes on the same
+        machine*/
+    helics_core_type_shm = 8,
     helics_core_type_zmq_test =
         10, /*!< single socket version of ZMQ core usually for high fed count on the same system*/
     helics_core_type_nng = 9, /*!< for using the nanomsg communications */
@@ -111,6 +114,9 @@ typedef enum {
 		If the federate goes offline there is no good way to detect it so use with caution
 		*/
     helics_flag_slow_responding = 29,
+    /** flag indicating that a federate should spin polling for messages instead of sleeping while
+        it waits on time grants and mode changes,  trading cpu usage for latency*/
+    helics_flag_busy_poll = 31,
     /** used to delay a core from entering initialization mode even if it would otherwise be ready*/
     helics_flag_delay_init_entry = 45,
     /** used to clear the HELICS_DELAY_INIT_ENTRY flag in cores*/
@@ -195,7 +201,10 @@ typedef enum {
     /** integer property controlling the log level for file logging in a federate see \ref helics_log_levels*/
     helics_property_int_file_log_level = 272,
     /** integer property controlling the log level for file logging in a federate see \ref helics_log_levels*/
-    helics_property_int_console_log_level = 274
+    helics_property_int_console_log_level = 274,
+    /** integer property controlling the number of microseconds a busy polling federate spins before
+       sleeping,  0 spins without limit see \ref helics_flag_busy_poll*/
+    helics_property_int_busy_poll_budget = 278
 } helics_properties;
 
 /** enumeration of options that apply to handles*/
@@ -6,11 +6,13 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 
 #pragma once
+#include "helics/common/ThreadPlacement.hpp"
 #include "helics/core/ActionMessage.hpp"
 
 #include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace helics {
 class CommsInterface;
@@ -41,6 +43,9 @@ class CommsBroker: public BrokerT {
     /** load the comms object directly*/
     void loadComms();
 
+  protected:
+    virtual std::vector<ThreadPlacementInfo> getThreadPlacement() const override;
+
   public:
     virtual void transmit(route_id rid, const ActionMessage& cmd) override;
     virtual void transmit(route_id rid, ActionMessage&& cmd) override;
@@ -16,6 +16,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 namespace helics {
 template<class COMMS, class BrokerT>
 CommsBroker<COMMS, BrokerT>::CommsBroker() noexcept
@@ -126,6 +127,15 @@ void CommsBroker<COMMS, BrokerT>::removeRoute(route_id rid)
     comms->removeRoute(rid);
 }
 
+template<class COMMS, class BrokerT>
+std::vector<ThreadPlacementInfo> CommsBroker<COMMS, BrokerT>::getThreadPlacement() const
+{
+    auto placement = BrokerT::getThreadPlacement();
+    auto commsPlacement = comms->getThreadPlacement();
+    placement.insert(placement.end(), commsPlacement.begin(), commsPlacement.end());
+    return placement;
+}
+
 template<class COMMS, class BrokerT>
 COMMS* CommsBroker<COMMS, BrokerT>::getCommsObjectPointer()
 {
@@ -10,6 +10,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "NetworkBrokerData.hpp"
 #include "gmlc/utilities/stringOps.h"
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -282,6 +283,7 @@ bool CommsInterface::connect()
     }
     if (!singleThread) {
         queue_watcher = std::thread([this] {
+            placeThread("rx", rxThreadPlacement);
             try {
                 queue_rx_function();
             }
@@ -293,6 +295,7 @@ bool CommsInterface::connect()
     }
 
     queue_transmitter = std::thread([this] {
+        placeThread("tx", txThreadPlacement);
         try {
             queue_tx_function();
         }
@@ -523,6 +526,39 @@ void CommsInterface::setTimeout(std::chrono::milliseconds timeOut)
     }
 }
 
+void CommsInterface::setThreadPlacement(
+    const ThreadPlacement& txPlacement,
+    const ThreadPlacement& rxPlacement)
+{
+    if (propertyLock()) {
+        txThreadPlacement = txPlacement;
+        rxThreadPlacement = rxPlacement;
+        propertyUnLock();
+    }
+}
+
+std::vector<ThreadPlacementInfo> CommsInterface::getThreadPlacement() const
+{
+    std::lock_guard<std::mutex> lock(placementLock);
+    return threadPlacements;
+}
+
+void CommsInterface::placeThread(const std::string& role, const ThreadPlacement& placement)
+{
+    auto info = placeCurrentThread(role, role + ":" + name, placement);
+    std::lock_guard<std::mutex> lock(placementLock);
+    // a reconnection restarts the threads so replace any previous record of the role
+    auto fnd = std::find_if(
+        threadPlacements.begin(), threadPlacements.end(), [&role](const auto& tinfo) {
+            return tinfo.role == role;
+        });
+    if (fnd != threadPlacements.end()) {
+        *fnd = std::move(info);
+    } else {
+        threadPlacements.push_back(std::move(info));
+    }
+}
+
 void CommsInterface::setServerMode(bool serverActive)
 {
     if (propertyLock()) {
@@ -6,6 +6,7 @@ SPDX-License-Identifier: BSD-3-Clause
 */
 #pragma once
 
+#include "../common/ThreadPlacement.hpp"
 #include "NetworkBrokerData.hpp"
 #include "gmlc/concurrency/TriggerVariable.hpp"
 #include "gmlc/concurrency/TripWire.hpp"
@@ -17,6 +18,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 namespace helics {
 enum class interface_networks : char;
@@ -89,6 +91,11 @@ class CommsInterface {
     virtual void setFlag(const std::string& flag, bool val);
     /** enable or disable the server mode for the comms*/
     void setServerMode(bool serverActive);
+    /** set the processors the transmit and receive threads should run on
+    @details must be called before connect*/
+    void setThreadPlacement(const ThreadPlacement& txPlacement, const ThreadPlacement& rxPlacement);
+    /** get the resulting placement of the running comms threads*/
+    std::vector<ThreadPlacementInfo> getThreadPlacement() const;
 
     /** generate a log message as a warning*/
     void logWarning(const std::string& message) const;
@@ -152,6 +159,12 @@ class CommsInterface {
     std::thread queue_transmitter; //!< single thread for sending data
     std::thread queue_watcher; //!< thread monitoring the receive queue
     std::mutex threadSyncLock; //!< lock to handle thread operations
+    ThreadPlacement txThreadPlacement; //!< the processors for the transmit thread
+    ThreadPlacement rxThreadPlacement; //!< the processors for the receive thread
+    mutable std::mutex placementLock; //!< lock protecting the thread placement information
+    std::vector<ThreadPlacementInfo> threadPlacements; //!< placement of the running threads
+    /** apply the placement of a thread role to the calling thread and record the result*/
+    void placeThread(const std::string& role, const ThreadPlacement& placement);
     virtual void queue_rx_function() = 0; //!< the functional loop for the receive queue
     virtual void queue_tx_function() = 0; //!< the loop for transmitting data
     virtual void closeTransmitter(); //!< function to instruct the transmitter loop to close
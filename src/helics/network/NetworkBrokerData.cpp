@@ -60,6 +60,17 @@ std::shared_ptr<helicsCLI11App>
             noAckConnection,
             "specify that a connection_ack message is not required to be connected with a broker")
         ->ignore_underscore();
+    nbparser
+        ->add_option(
+            "--encoding",
+            encoding,
+            "the message encoding to use (auto, standard, compact), auto uses the compact encoding on the "
+            "broker connection if the broker supports it, compact uses it on all connections")
+        ->transform(CLI::CheckedTransformer(
+            std::map<std::string, encoding_options>{{"auto", encoding_options::automatic},
+                                                    {"standard", encoding_options::standard},
+                                                    {"compact", encoding_options::compact}},
+            CLI::ignore_case));
     nbparser->add_option_function<std::string>(
         "--broker",
         [this, localAddress](std::string addr) {
@@ -89,6 +100,21 @@ std::shared_ptr<helicsCLI11App>
         ->check(CLI::PositiveNumber);
     nbparser->add_option("--networkretries", maxRetries, "the maximum number of network retries")
         ->capture_default_str();
+    nbparser
+        ->add_flag(
+            "--udp_batching",
+            udpBatching,
+            "pack multiple messages into each udp datagram and send and receive datagrams in "
+            "batches")
+        ->ignore_underscore();
+    nbparser
+        ->add_option(
+            "--udp_datagram_size",
+            udpDatagramSize,
+            "the maximum size of the udp datagrams used for packed messages with --udp_batching")
+        ->ignore_underscore()
+        ->capture_default_str()
+        ->check(CLI::Range(64, 8192));
     nbparser->add_flag(
         "--osport,--use_os_port",
         use_os_port,
@@ -154,6 +180,26 @@ std::shared_ptr<helicsCLI11App>
     return nbparser;
 }
 
+void NetworkBrokerData::addTcpBatchingOptions(helicsCLI11App& app)
+{
+    app.add_option(
+           "--tx_batch_bytes",
+           txBatchBytes,
+           "the maximum number of bytes of queued messages to combine into a single write on a "
+           "tcp connection, 0 to write each message separately")
+        ->ignore_underscore()
+        ->capture_default_str()
+        ->check(CLI::NonNegativeNumber);
+    app.add_option(
+           "--tx_linger",
+           txLinger,
+           "the time in microseconds to wait for additional messages before writing a partial "
+           "batch on a tcp connection")
+        ->ignore_underscore()
+        ->capture_default_str()
+        ->check(CLI::NonNegativeNumber);
+}
+
 void NetworkBrokerData::checkAndUpdateBrokerAddress(const std::string& localAddress)
 {
     switch (allowedType) {
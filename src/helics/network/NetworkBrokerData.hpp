@@ -42,6 +42,12 @@ class NetworkBrokerData {
         server_active = 3,
         server_deactivated = 4,
     };
+    /** the encodings to use for messages*/
+    enum class encoding_options : char {
+        automatic = 0, //!< use the compact encoding on the broker connection if the broker supports it
+        standard = 1, //!< always use the standard encoding
+        compact = 2, //!< use the compact encoding on all connections
+    };
 
     std::string brokerName; //!< the identifier for the broker
     std::string brokerAddress; //!< the address or domain name of the broker
@@ -53,6 +59,9 @@ class NetworkBrokerData {
     int maxMessageSize{16 * 256}; //!< maximum message size
     int maxMessageCount{256}; //!< maximum message count
     int maxRetries{5}; //!< the maximum number of retries to establish a network connection
+    int txBatchBytes{64 * 1024}; //!< the maximum bytes to combine into a single tcp write
+    int txLinger{0}; //!< microseconds to wait for more messages before sending a partial batch
+    int udpDatagramSize{1472}; //!< the maximum size of a udp datagram holding packed messages
     interface_networks interfaceNetwork{interface_networks::local};
     bool reuse_address{false}; //!< allow reuse of binding address
     bool use_os_port{
@@ -62,7 +71,9 @@ class NetworkBrokerData {
         false}; //!< flag indicating that the name should be appended to the address
     bool noAckConnection{
         false}; //!< flag indicating that a connection ack message is not required for broker connections
+    bool udpBatching{false}; //!< pack messages into datagrams and use batched udp system calls
     server_mode_options server_mode{server_mode_options::unspecified}; //!< setup a server mode
+    encoding_options encoding{encoding_options::automatic}; //!< the message encoding to use
   public:
     NetworkBrokerData() = default;
     /** constructor from the allowed type*/
@@ -73,6 +84,9 @@ class NetworkBrokerData {
     */
     std::shared_ptr<helicsCLI11App>
         commandLineParser(const std::string& localAddress, bool enableConfig = true);
+    /** add the options for the tcp transmit batching to a command line parser
+    @details these only apply to the tcp comms so only the tcp core and broker add them*/
+    void addTcpBatchingOptions(helicsCLI11App& app);
     /** set the desired interface type
      */
     void setInterfaceType(interface_type type) { allowedType = type; }
@@ -23,7 +23,7 @@ constexpr const char* tstr[] = {"default",
                                 "interprocess",
                                 "TCP",
                                 "UDP",
-                                "undef",
+                                "SHM",
                                 "nng",
                                 "ZMQ_SS",
                                 "TCPSS",
@@ -76,6 +76,8 @@ bool NetworkBroker<COMMS, baseline, tcode>::brokerConnect()
     CommsBroker<COMMS, CoreBroker>::comms->setName(CoreBroker::getIdentifier());
     CommsBroker<COMMS, CoreBroker>::comms->loadNetworkInfo(netInfo);
     CommsBroker<COMMS, CoreBroker>::comms->setTimeout(BrokerBase::networkTimeout.to_ms());
+    CommsBroker<COMMS, CoreBroker>::comms->setThreadPlacement(
+        BrokerBase::txThreadPlacement, BrokerBase::rxThreadPlacement);
 
     auto res = CommsBroker<COMMS, CoreBroker>::comms->connect();
     if (res) {
@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../common/fmt_format.h"
 #include "NetworkBrokerData.hpp"
 #include "helics/core/ActionMessage.hpp"
+#include "helics/core/flagOperations.hpp"
 
 #include <memory>
 #include <string>
@@ -122,6 +123,7 @@ void NetworkCommsInterface::loadNetworkInfo(const NetworkBrokerData& netInfo)
     useOsPortAllocation = netInfo.use_os_port;
     appendNameToAddress = netInfo.appendNameToAddress;
     noAckConnection = netInfo.noAckConnection;
+    encoding = netInfo.encoding;
     propertyUnLock();
 }
 
@@ -183,11 +185,17 @@ void NetworkCommsInterface::setFlag(const std::string& flag, bool val)
 ActionMessage NetworkCommsInterface::generateReplyToIncomingMessage(ActionMessage& cmd)
 {
     if (isProtocolCommand(cmd)) {
+        // the reply accepts the compact encoding if it was requested and is allowed here
+        bool acceptCompact = checkActionFlag(cmd, compact_encoding_flag) &&
+            (encoding != NetworkBrokerData::encoding_options::standard);
         switch (cmd.messageID) {
             case QUERY_PORTS: {
                 ActionMessage portReply(CMD_PROTOCOL);
                 portReply.messageID = PORT_DEFINITIONS;
                 portReply.setExtraData(PortNumber);
+                if (acceptCompact) {
+                    setActionFlag(portReply, compact_encoding_flag);
+                }
                 return portReply;
             } break;
             case REQUEST_PORTS: {
@@ -199,11 +207,17 @@ ActionMessage NetworkCommsInterface::generateReplyToIncomingMessage(ActionMessag
                 portReply.source_id = global_federate_id(PortNumber);
                 portReply.setExtraData(openPort);
                 portReply.counter = cmd.counter;
+                if (acceptCompact) {
+                    setActionFlag(portReply, compact_encoding_flag);
+                }
                 return portReply;
             } break;
             case CONNECTION_REQUEST: {
                 ActionMessage connAck(CMD_PROTOCOL);
                 connAck.messageID = CONNECTION_ACK;
+                if (acceptCompact) {
+                    setActionFlag(connAck, compact_encoding_flag);
+                }
                 return connAck;
             } break;
             default:
@@ -241,14 +255,41 @@ ActionMessage NetworkCommsInterface::generatePortRequest(int cnt) const
     req.payload = stripProtocol(localTargetAddress);
     req.counter = cnt;
     req.setStringData(brokerName, brokerInitString);
+    addEncodingRequest(req);
     return req;
 }
 
+void NetworkCommsInterface::addEncodingRequest(ActionMessage& cmd) const
+{
+    if (encoding != NetworkBrokerData::encoding_options::standard) {
+        setActionFlag(cmd, compact_encoding_flag);
+    }
+}
+
+void NetworkCommsInterface::checkEncodingReply(const ActionMessage& cmd)
+{
+    compactBrokerEncoding = (encoding != NetworkBrokerData::encoding_options::standard) &&
+        checkActionFlag(cmd, compact_encoding_flag);
+}
+
+bool NetworkCommsInterface::checkEncoding(const ActionMessage& cmd) const
+{
+    if (encoding == NetworkBrokerData::encoding_options::standard &&
+        cmd.requiresCompactEncoding()) {
+        logError(fmt::format(
+            "message too large for the standard encoding (--encoding=standard), message dropped {}",
+            prettyPrintString(cmd)));
+        return false;
+    }
+    return true;
+}
+
 void NetworkCommsInterface::loadPortDefinitions(const ActionMessage& cmd)
 {
     if (cmd.action() == CMD_PROTOCOL) {
         if (cmd.messageID == PORT_DEFINITIONS) {
             PortNumber = cmd.getExtraData();
+            checkEncodingReply(cmd);
             if ((openPorts.getDefaultStartingPort() < 0)) {
                 if (PortNumber < getDefaultBrokerPort() + 100) {
                     openPorts.setStartingPortNumber(
@@ -64,6 +64,10 @@ class NetworkCommsInterface: public CommsInterface {
     interface_networks network{interface_networks::ipv4};
     std::atomic<bool> hasBroker{false};
     int maxRetries{5}; // the maximum number of network retries
+    NetworkBrokerData::encoding_options encoding{
+        NetworkBrokerData::encoding_options::automatic}; //!< the message encoding option
+    std::atomic<bool> compactBrokerEncoding{
+        false}; //!< indicator that the broker connection uses the compact encoding
 
   private:
     PortAllocator openPorts; //!< a structure to deal with port allocations
@@ -85,6 +89,24 @@ class NetworkCommsInterface: public CommsInterface {
   protected:
     ActionMessage generatePortRequest(int cnt = 1) const;
     void loadPortDefinitions(const ActionMessage& cmd);
+    /** mark a connection request as supporting the compact encoding if it is allowed*/
+    void addEncodingRequest(ActionMessage& cmd) const;
+    /** check a reply to a connection request for acceptance of the compact encoding*/
+    void checkEncodingReply(const ActionMessage& cmd);
+    /** check if a message on a route should use the compact encoding
+    @details in automatic mode messages too large for the standard encoding use the compact
+    encoding*/
+    bool useCompactEncoding(route_id rid, const ActionMessage& cmd) const
+    {
+        return (encoding == NetworkBrokerData::encoding_options::compact) ||
+            (rid == parent_route_id && compactBrokerEncoding.load()) ||
+            (encoding == NetworkBrokerData::encoding_options::automatic &&
+             cmd.requiresCompactEncoding());
+    }
+    /** check that a message can be sent with the configured encoding
+    @details logs an error if the standard encoding is required and the message is too large for it
+    @return true if the message can be sent*/
+    bool checkEncoding(const ActionMessage& cmd) const;
 };
 
 } // namespace helics
@@ -0,0 +1,14 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ShmBroker.h"
+
+#include "../NetworkBroker_impl.hpp"
+#include "ShmComms.h"
+
+namespace helics {
+template class NetworkBroker<shm::ShmComms, interface_type::ipc, static_cast<int>(core_type::SHM)>;
+} // namespace helics
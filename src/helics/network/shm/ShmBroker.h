@@ -0,0 +1,20 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "../NetworkBroker.hpp"
+
+namespace helics {
+namespace shm {
+    class ShmComms;
+
+    /** implementation for the broker that uses shared memory rings to communicate*/
+    using ShmBroker =
+        NetworkBroker<ShmComms, interface_type::ipc, static_cast<int>(core_type::SHM)>;
+
+} // namespace shm
+} // namespace helics
@@ -0,0 +1,209 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ShmComms.h"
+
+#include "../../common/fmt_format.h"
+#include "../../core/ActionMessage.hpp"
+#include "../../core/helics_definitions.hpp"
+#include "ShmQueueHelper.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <utility>
+
+namespace helics {
+namespace shm {
+    ShmComms::ShmComms()
+    {
+        // override the default value for this comm system
+        maxMessageCount = 256;
+    }
+    /** destructor*/
+    ShmComms::~ShmComms() { disconnect(); }
+
+    void ShmComms::loadNetworkInfo(const NetworkBrokerData& netInfo)
+    {
+        CommsInterface::loadNetworkInfo(netInfo);
+        if (!propertyLock()) {
+            return;
+        }
+        if (localTargetAddress.empty()) {
+            if (serverMode) {
+                localTargetAddress = "_ipc_broker";
+            } else {
+                localTargetAddress = name;
+            }
+        }
+        propertyUnLock();
+    }
+
+    void ShmComms::queue_rx_function()
+    {
+        OwnedMailbox mailbox;
+        const auto ringSize = computeRingSize(maxMessageSize, maxMessageCount);
+        bool connected = mailbox.connect(localTargetAddress, ringSize);
+        if (!connected) {
+            std::this_thread::sleep_for(connectionTimeout);
+            connected = mailbox.connect(localTargetAddress, ringSize);
+            if (!connected) {
+                disconnecting = true;
+                ActionMessage err(CMD_ERROR);
+                err.messageID = defs::errors::connection_failure;
+                err.payload = mailbox.getError();
+                ActionCallback(std::move(err));
+                setRxStatus(connection_status::error); // the connection has failed
+                return;
+            }
+        }
+        setRxStatus(
+            connection_status::connected); // this is a atomic indicator that the rx queue is ready
+        while (true) {
+            if (mailbox.closeRequested()) {
+                disconnecting = true;
+                break;
+            }
+            auto cmdopt = mailbox.getMessage(std::chrono::milliseconds(2000));
+            if (!cmdopt) {
+                continue;
+            }
+            if (isProtocolCommand(*cmdopt)) {
+                if (cmdopt->messageID == CLOSE_RECEIVER) {
+                    disconnecting = true;
+                    break;
+                }
+                continue;
+            }
+            ActionCallback(std::move(*cmdopt));
+        }
+        mailbox.changeState(mailbox_state_t::closing);
+        setRxStatus(connection_status::terminated);
+    }
+
+    void ShmComms::queue_tx_function()
+    {
+        MailboxSender brokerMailbox; //!< the mailbox of the broker
+        MailboxSender rxMailbox;
+        std::map<route_id, MailboxSender> routes; //!< table of the routes to other brokers
+        bool hasBroker = false;
+
+        if (!brokerTargetAddress.empty()) {
+            bool conn = brokerMailbox.connect(brokerTargetAddress, 20);
+            if (!conn) {
+                std::this_thread::sleep_for(connectionTimeout);
+                conn = brokerMailbox.connect(brokerTargetAddress, 20);
+                if (!conn) {
+                    ActionMessage err(CMD_ERROR);
+                    err.payload = fmt::format(
+                        "Unable to open broker connection -> {}", brokerMailbox.getError());
+                    err.messageID = defs::errors::connection_failure;
+                    ActionCallback(std::move(err));
+                    setTxStatus(connection_status::error);
+                    return;
+                }
+            }
+            hasBroker = true;
+        }
+        // wait for the receiver to startup
+        if (!rxTrigger.wait_forActivation(connectionTimeout)) {
+            ActionMessage err(CMD_ERROR);
+            err.messageID = defs::errors::connection_failure;
+            err.payload = "Unable to link with receiver";
+            ActionCallback(std::move(err));
+            setTxStatus(connection_status::error);
+            return;
+        }
+        if (getRxStatus() == connection_status::error) {
+            setTxStatus(connection_status::error);
+            return;
+        }
+        if (!rxMailbox.connect(localTargetAddress, 3)) {
+            ActionMessage err(CMD_ERROR);
+            err.messageID = defs::errors::connection_failure;
+            err.payload =
+                fmt::format("Unable to open receiver connection -> {}", rxMailbox.getError());
+            ActionCallback(std::move(err));
+            setTxStatus(connection_status::error);
+            return;
+        }
+
+        setTxStatus(connection_status::connected);
+        auto send = [this](MailboxSender& target, const ActionMessage& cmd) {
+            if (!target.sendMessage(cmd) && !disconnecting) {
+                logWarning(fmt::format(
+                    "unable to send {} -> {}", prettyPrintString(cmd), target.getError()));
+            }
+        };
+        bool continueLoop{true};
+        while (continueLoop) {
+            route_id rid;
+            ActionMessage cmd;
+            std::tie(rid, cmd) = txQueue.pop();
+            if (isProtocolCommand(cmd)) {
+                if (rid == control_route) {
+                    switch (cmd.messageID) {
+                        case NEW_ROUTE: {
+                            MailboxSender newMailbox;
+                            if (newMailbox.connect(cmd.payload, 3)) {
+                                routes[route_id{cmd.getExtraData()}] = std::move(newMailbox);
+                            } else {
+                                logWarning(fmt::format(
+                                    "unable to open route to {} -> {}",
+                                    cmd.payload,
+                                    newMailbox.getError()));
+                            }
+                            continue;
+                        }
+                        case REMOVE_ROUTE:
+                            routes.erase(route_id{cmd.getExtraData()});
+                            continue;
+                        case DISCONNECT:
+                            continueLoop = false;
+                            continue;
+                    }
+                }
+            }
+            if (rid == parent_route_id) {
+                if (hasBroker) {
+                    send(brokerMailbox, cmd);
+                }
+            } else if (rid == control_route) {
+                send(rxMailbox, cmd);
+            } else {
+                auto routeFnd = routes.find(rid);
+                if (routeFnd != routes.end()) {
+                    send(routeFnd->second, cmd);
+                } else if (hasBroker) {
+                    send(brokerMailbox, cmd);
+                }
+            }
+        }
+        setTxStatus(connection_status::terminated);
+    }
+
+    void ShmComms::closeReceiver()
+    {
+        if ((getRxStatus() == connection_status::error) ||
+            (getRxStatus() == connection_status::terminated)) {
+            return;
+        }
+        if (getTxStatus() == connection_status::connected) {
+            ActionMessage cmd(CMD_PROTOCOL);
+            cmd.messageID = CLOSE_RECEIVER;
+            transmit(control_route, cmd);
+        } else if (!disconnecting) {
+            // the transmitter is not available so flag the mailbox directly
+            MailboxSender::requestClose(localTargetAddress);
+        }
+    }
+
+    std::string ShmComms::getAddress() const { return localTargetAddress; }
+
+} // namespace shm
+} // namespace helics
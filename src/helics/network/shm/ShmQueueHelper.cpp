@@ -0,0 +1,522 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "ShmQueueHelper.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#    include <linux/futex.h>
+#    include <sys/syscall.h>
+#    include <time.h>
+#endif
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <cerrno>
+#    include <signal.h>
+#    include <unistd.h>
+#endif
+
+namespace boostipc = boost::interprocess;
+
+namespace helics {
+namespace shm {
+    static constexpr uint32_t mailboxMagic{0x48534D42};
+    /** length value indicating the rest of the ring is unused and the next record is at the start*/
+    static constexpr uint32_t wrapMarker{0xFFFFFFFF};
+    /** the number of bytes used for the length of each record*/
+    static constexpr uint32_t recordHeaderSize{sizeof(uint32_t)};
+    /** the number of times the receiver checks for data before sleeping*/
+    static constexpr int receiverSpinCount{64};
+    /** the number of messages read from one ring before moving on to the next*/
+    static constexpr int maxReadsPerRing{64};
+
+    static_assert(
+        sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+        "the doorbell must be usable as a plain 32 bit integer");
+
+    static constexpr std::size_t alignUp(std::size_t value, std::size_t alignment)
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    static std::size_t ringStride(uint32_t ringSize) { return sizeof(RingControl) + ringSize; }
+
+    static std::size_t ringOffset() { return alignUp(sizeof(MailboxHeader), alignof(RingControl)); }
+
+    static std::size_t mailboxBytes(uint32_t ringSize)
+    {
+        return ringOffset() + maxMailboxConnections * ringStride(ringSize);
+    }
+
+    static RingControl* ringAt(char* rings, uint32_t ringSize, uint32_t index)
+    {
+        return reinterpret_cast<RingControl*>(rings + index * ringStride(ringSize));
+    }
+
+    static char* ringData(RingControl* ring) { return reinterpret_cast<char*>(ring + 1); }
+
+    static uint32_t recordSize(uint32_t length)
+    {
+        return static_cast<uint32_t>(alignUp(length + recordHeaderSize, 8));
+    }
+
+    static int64_t currentProcess()
+    {
+#ifdef _WIN32
+        return static_cast<int64_t>(GetCurrentProcessId());
+#else
+        return static_cast<int64_t>(getpid());
+#endif
+    }
+
+    /** check if a process still exists,  errs on the side of the process being alive*/
+    static bool processExists(int64_t process)
+    {
+#ifdef _WIN32
+        HANDLE proc = OpenProcess(SYNCHRONIZE, FALSE, static_cast<DWORD>(process));
+        if (proc == nullptr) {
+            return GetLastError() != ERROR_INVALID_PARAMETER;
+        }
+        bool running = (WaitForSingleObject(proc, 0) == WAIT_TIMEOUT);
+        CloseHandle(proc);
+        return running;
+#else
+        return (kill(static_cast<pid_t>(process), 0) == 0) || (errno != ESRCH);
+#endif
+    }
+
+    /** sleep until the doorbell changes from the expected value or the timeout expires*/
+    static void waitOnDoorbell(
+        std::atomic<uint32_t>& doorbell,
+        uint32_t expected,
+        std::chrono::microseconds timeout)
+    {
+#ifdef __linux__
+        timespec wait;
+        wait.tv_sec = static_cast<time_t>(timeout.count() / 1000000);
+        wait.tv_nsec = static_cast<long>((timeout.count() % 1000000) * 1000);
+        // the mailbox is shared between processes so the shared (non private) futex is used
+        syscall(
+            SYS_futex,
+            reinterpret_cast<uint32_t*>(&doorbell),
+            FUTEX_WAIT,
+            expected,
+            &wait,
+            nullptr,
+            0);
+#else
+        if (doorbell.load(std::memory_order_acquire) == expected) {
+            std::this_thread::sleep_for(std::min(timeout, std::chrono::microseconds(200)));
+        }
+#endif
+    }
+
+    /** wake the receiver of a mailbox if it is sleeping*/
+    static void ringDoorbell(MailboxHeader* header, bool force = false)
+    {
+        // pairs with the fence in the receiver so either the data or the sleeping flag is seen
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (force || header->sleeping.load(std::memory_order_relaxed) != 0) {
+            header->doorbell.fetch_add(1, std::memory_order_release);
+#ifdef __linux__
+            syscall(
+                SYS_futex,
+                reinterpret_cast<uint32_t*>(&header->doorbell),
+                FUTEX_WAKE,
+                INT_MAX,
+                nullptr,
+                nullptr,
+                0);
+#endif
+        }
+    }
+
+    std::string mailboxName(const std::string& connection)
+    {
+        std::string name = connection;
+        std::replace_if(
+            name.begin(),
+            name.end(),
+            [](auto c) { return !(std::isalnum(c) || (c == '_')); },
+            '_');
+        return std::string("helics_shm_") + name;
+    }
+
+    uint32_t computeRingSize(int maxMessageSize, int maxMessageCount)
+    {
+        constexpr uint64_t minRingSize{64 * 1024};
+        constexpr uint64_t maxRingSize{64 * 1024 * 1024};
+        // the ring should hold a good fraction of the message count,  and any single message twice
+        uint64_t target = static_cast<uint64_t>(std::max(maxMessageSize, 1)) *
+            static_cast<uint64_t>(std::max(maxMessageCount, 1)) / 4;
+        target = std::max(target, 2 * static_cast<uint64_t>(std::max(maxMessageSize, 1)) + 64);
+        uint64_t ringSize{minRingSize};
+        while (ringSize < target && ringSize < maxRingSize) {
+            ringSize <<= 1U;
+        }
+        return static_cast<uint32_t>(ringSize);
+    }
+
+    OwnedMailbox::~OwnedMailbox()
+    {
+        if (connected) {
+            changeState(mailbox_state_t::closing);
+            region.reset();
+            memory.reset();
+            boostipc::shared_memory_object::remove(connectionName.c_str());
+        }
+    }
+
+    bool OwnedMailbox::connect(const std::string& connection, uint32_t ringSize)
+    {
+        if (connected) {
+            changeState(mailbox_state_t::closing);
+            region.reset();
+            memory.reset();
+            boostipc::shared_memory_object::remove(connectionName.c_str());
+            connected = false;
+        }
+        connectionName = mailboxName(connection);
+        // remove any leftover mailbox from a previous run
+        boostipc::shared_memory_object::remove(connectionName.c_str());
+        try {
+            memory = std::make_unique<boostipc::shared_memory_object>(
+                boostipc::create_only, connectionName.c_str(), boostipc::read_write);
+            memory->truncate(static_cast<boostipc::offset_t>(mailboxBytes(ringSize)));
+            region = std::make_unique<boostipc::mapped_region>(*memory, boostipc::read_write);
+        }
+        catch (boostipc::interprocess_exception const& ipe) {
+            errorString = std::string("Unable to create shared memory mailbox:") + ipe.what();
+            region.reset();
+            memory.reset();
+            return false;
+        }
+        auto* base = static_cast<char*>(region->get_address());
+        header = new (base) MailboxHeader;
+        header->ringSize = ringSize;
+        rings = base + ringOffset();
+        for (uint32_t ii = 0; ii < maxMailboxConnections; ++ii) {
+            new (ringAt(rings, ringSize, ii)) RingControl;
+        }
+        header->state.store(
+            static_cast<int32_t>(mailbox_state_t::connected), std::memory_order_relaxed);
+        // publishing the magic number makes the mailbox visible to senders
+        header->magic.store(mailboxMagic, std::memory_order_release);
+        currentRing = 0;
+        readsOnRing = 0;
+        connected = true;
+        return true;
+    }
+
+    void OwnedMailbox::changeState(mailbox_state_t newState)
+    {
+        if (connected) {
+            header->state.store(static_cast<int32_t>(newState), std::memory_order_release);
+        }
+    }
+
+    bool OwnedMailbox::closeRequested() const
+    {
+        return connected && header->closeRequest.load(std::memory_order_acquire) != 0;
+    }
+
+    stx::optional<ActionMessage> OwnedMailbox::tryGetMessage()
+    {
+        const auto inUse = header->ringsInUse.load(std::memory_order_acquire);
+        const auto ringSize = header->ringSize;
+        const auto mask = ringSize - 1;
+        // visit every ring once and come back around to the current one
+        for (uint32_t checked = 0; checked <= inUse; ++checked) {
+            if (currentRing >= inUse) {
+                currentRing = 0;
+            }
+            auto* ring = ringAt(rings, ringSize, currentRing);
+            if (readsOnRing < maxReadsPerRing &&
+                ring->owner.load(std::memory_order_acquire) != 0) {
+                auto* data = ringData(ring);
+                auto tail = ring->tail.load(std::memory_order_relaxed);
+                auto head = ring->head.load(std::memory_order_acquire);
+                while (tail != head) {
+                    auto offset = tail & mask;
+                    uint32_t length{0};
+                    std::memcpy(&length, data + offset, sizeof(uint32_t));
+                    if (length == wrapMarker) {
+                        tail += ringSize - offset;
+                        continue;
+                    }
+                    ActionMessage cmd;
+                    cmd.fromByteArray(data + offset + recordHeaderSize, static_cast<int>(length));
+                    tail += recordSize(length);
+                    ring->tail.store(tail, std::memory_order_release);
+                    if (!isValidCommand(cmd)) {
+                        continue;
+                    }
+                    ++readsOnRing;
+                    return cmd;
+                }
+                ring->tail.store(tail, std::memory_order_release);
+                uint32_t released{2};
+                if (ring->owner.load(std::memory_order_acquire) == released &&
+                    ring->head.load(std::memory_order_acquire) == tail) {
+                    // the sender has let go of the ring and everything has been read
+                    ring->owner.compare_exchange_strong(released, 0, std::memory_order_acq_rel);
+                }
+            }
+            readsOnRing = 0;
+            ++currentRing;
+        }
+        return stx::nullopt;
+    }
+
+    stx::optional<ActionMessage> OwnedMailbox::getMessage(std::chrono::milliseconds timeout)
+    {
+        if (!connected) {
+            return stx::nullopt;
+        }
+        auto msg = tryGetMessage();
+        if (msg) {
+            return msg;
+        }
+        for (int ii = 0; ii < receiverSpinCount; ++ii) {
+            std::this_thread::yield();
+            msg = tryGetMessage();
+            if (msg) {
+                return msg;
+            }
+        }
+        const auto stop = std::chrono::steady_clock::now() + timeout;
+        while (true) {
+            auto bell = header->doorbell.load(std::memory_order_acquire);
+            header->sleeping.store(1, std::memory_order_relaxed);
+            // pairs with the fence in ringDoorbell so a message sent now will wake the receiver
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            msg = tryGetMessage();
+            if (msg || closeRequested()) {
+                header->sleeping.store(0, std::memory_order_relaxed);
+                return msg;
+            }
+            auto now = std::chrono::steady_clock::now();
+            if (now >= stop) {
+                header->sleeping.store(0, std::memory_order_relaxed);
+                return stx::nullopt;
+            }
+            waitOnDoorbell(
+                header->doorbell,
+                bell,
+                std::chrono::duration_cast<std::chrono::microseconds>(stop - now));
+            header->sleeping.store(0, std::memory_order_relaxed);
+            msg = tryGetMessage();
+            if (msg) {
+                return msg;
+            }
+        }
+    }
+
+    MailboxSender::MailboxSender(MailboxSender&& other) noexcept:
+        memory(std::move(other.memory)), region(std::move(other.region)), header(other.header),
+        ring(other.ring), data(other.data), errorString(std::move(other.errorString)),
+        mask(other.mask)
+    {
+        other.header = nullptr;
+        other.ring = nullptr;
+        other.data = nullptr;
+    }
+
+    MailboxSender& MailboxSender::operator=(MailboxSender&& other) noexcept
+    {
+        if (this != &other) {
+            release();
+            memory = std::move(other.memory);
+            region = std::move(other.region);
+            header = other.header;
+            ring = other.ring;
+            data = other.data;
+            errorString = std::move(other.errorString);
+            mask = other.mask;
+            other.header = nullptr;
+            other.ring = nullptr;
+            other.data = nullptr;
+        }
+        return *this;
+    }
+
+    MailboxSender::~MailboxSender() { release(); }
+
+    void MailboxSender::release()
+    {
+        if (ring != nullptr) {
+            // clear the process first so a later claim of the ring is never mistaken for this one
+            ring->ownerProcess.store(0, std::memory_order_release);
+            ring->owner.store(2, std::memory_order_release);
+            ringDoorbell(header);
+        }
+        ring = nullptr;
+        data = nullptr;
+        header = nullptr;
+        region.reset();
+        memory.reset();
+    }
+
+    /** open the mailbox shared memory,  returns nullptr if the mailbox is not ready*/
+    static MailboxHeader* openMailbox(
+        const std::string& connection,
+        std::unique_ptr<boostipc::shared_memory_object>& memory,
+        std::unique_ptr<boostipc::mapped_region>& region,
+        std::string& errorString)
+    {
+        try {
+            memory = std::make_unique<boostipc::shared_memory_object>(
+                boostipc::open_only, mailboxName(connection).c_str(), boostipc::read_write);
+            region = std::make_unique<boostipc::mapped_region>(*memory, boostipc::read_write);
+        }
+        catch (boostipc::interprocess_exception const& ipe) {
+            // this likely means the mailbox doesn't exist yet
+            errorString = std::string("Unable to open connection:") + ipe.what();
+            region.reset();
+            memory.reset();
+            return nullptr;
+        }
+        auto* header = static_cast<MailboxHeader*>(region->get_address());
+        if (region->get_size() < sizeof(MailboxHeader) ||
+            header->magic.load(std::memory_order_acquire) != mailboxMagic ||
+            header->state.load(std::memory_order_acquire) ==
+                static_cast<int32_t>(mailbox_state_t::closing)) {
+            errorString = "timed out waiting for the mailbox to become available";
+            region.reset();
+            memory.reset();
+            return nullptr;
+        }
+        return header;
+    }
+
+    bool MailboxSender::connect(const std::string& connection, int retries)
+    {
+        release();
+        int tries = 0;
+        while (true) {
+            header = openMailbox(connection, memory, region, errorString);
+            if (header != nullptr) {
+                break;
+            }
+            ++tries;
+            if (tries > retries) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        }
+        const auto ringSize = header->ringSize;
+        auto* rings = static_cast<char*>(region->get_address()) + ringOffset();
+        const auto self = currentProcess();
+        for (uint32_t ii = 0; ii < maxMailboxConnections; ++ii) {
+            auto* candidate = ringAt(rings, ringSize, ii);
+            uint32_t expected{0};
+            bool claimed =
+                candidate->owner.compare_exchange_strong(expected, 1, std::memory_order_acq_rel);
+            if (claimed) {
+                candidate->ownerProcess.store(self, std::memory_order_release);
+            } else if (expected == 1) {
+                // a sender that died never releases its ring so take it over,  the records it
+                // completed are still read and the new sender continues from its head
+                auto previous = candidate->ownerProcess.load(std::memory_order_acquire);
+                claimed = (previous != 0 && previous != self && !processExists(previous) &&
+                           candidate->ownerProcess.compare_exchange_strong(
+                               previous, self, std::memory_order_acq_rel));
+            }
+            if (claimed) {
+                ring = candidate;
+                data = ringData(candidate);
+                mask = ringSize - 1;
+                auto inUse = header->ringsInUse.load(std::memory_order_relaxed);
+                while (inUse < ii + 1 &&
+                       !header->ringsInUse.compare_exchange_weak(
+                           inUse, ii + 1, std::memory_order_acq_rel)) {
+                }
+                return true;
+            }
+        }
+        errorString = "no free connections available in the mailbox";
+        header = nullptr;
+        region.reset();
+        memory.reset();
+        return false;
+    }
+
+    bool MailboxSender::sendMessage(const ActionMessage& cmd)
+    {
+        if (ring == nullptr) {
+            errorString = "mailbox is not connected";
+            return false;
+        }
+        const uint32_t ringSize = mask + 1;
+        const auto size = cmd.serializedByteCount();
+        const auto needed = recordSize(static_cast<uint32_t>(size));
+        // limiting records to half the ring means a record always fits after a wrap
+        if (needed > ringSize / 2) {
+            errorString = "message of " + std::to_string(size) + " bytes is too large for the ring";
+            return false;
+        }
+        auto head = ring->head.load(std::memory_order_relaxed);
+        auto offset = head & mask;
+        const uint32_t contiguous = ringSize - offset;
+        const uint32_t required = (contiguous < needed) ? needed + contiguous : needed;
+        int waits{0};
+        while (ringSize - (head - ring->tail.load(std::memory_order_acquire)) < required) {
+            if (header->state.load(std::memory_order_acquire) ==
+                static_cast<int32_t>(mailbox_state_t::closing)) {
+                errorString = "mailbox has closed";
+                return false;
+            }
+            ringDoorbell(header);
+            if (++waits < 64) {
+                std::this_thread::yield();
+            } else {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+        if (contiguous < needed) {
+            std::memcpy(data + offset, &wrapMarker, sizeof(uint32_t));
+            head += contiguous;
+            offset = 0;
+        }
+        // serialize straight into the shared ring
+        auto used = cmd.toByteArray(data + offset + recordHeaderSize, size);
+        if (used < 0) {
+            errorString = "unable to serialize message";
+            return false;
+        }
+        auto length = static_cast<uint32_t>(used);
+        std::memcpy(data + offset, &length, sizeof(uint32_t));
+        ring->head.store(head + recordSize(length), std::memory_order_release);
+        ringDoorbell(header);
+        return true;
+    }
+
+    bool MailboxSender::requestClose(const std::string& connection)
+    {
+        std::unique_ptr<boostipc::shared_memory_object> memory;
+        std::unique_ptr<boostipc::mapped_region> region;
+        std::string error;
+        auto* header = openMailbox(connection, memory, region, error);
+        if (header == nullptr) {
+            return false;
+        }
+        header->closeRequest.store(1, std::memory_order_release);
+        ringDoorbell(header, true);
+        return true;
+    }
+} // namespace shm
+} // namespace helics
@@ -0,0 +1,124 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#pragma once
+
+#include "gmlc/containers/extra/optional.hpp"
+#include "helics/core/ActionMessage.hpp"
+
+#include <atomic>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/shared_memory_object.hpp>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace helics {
+namespace shm {
+    /** the maximum number of senders that can be attached to a single mailbox*/
+    constexpr uint32_t maxMailboxConnections{64};
+
+    /** translate a connection name into the name of the shared memory object holding the mailbox*/
+    std::string mailboxName(const std::string& connection);
+
+    /** compute the ring size for a mailbox from the message size and count settings*/
+    uint32_t computeRingSize(int maxMessageSize, int maxMessageCount);
+
+    /** enumeration of mailbox states*/
+    enum class mailbox_state_t : int32_t {
+        startup = 0,
+        connected = 1,
+        closing = 2,
+    };
+
+    /** the control block of a single producer single consumer byte ring in shared memory
+    @details the head and tail are byte counters that wrap naturally,  the position in the ring is
+    the counter masked by the ring size*/
+    struct RingControl {
+        /** 0 if free, 1 if claimed by a sender, 2 if released but not yet drained*/
+        std::atomic<uint32_t> owner{0};
+        /** the process id of the claiming sender,  0 while a claim is in progress*/
+        std::atomic<int64_t> ownerProcess{0};
+        alignas(64) std::atomic<uint32_t> head{0}; //!< write counter,  only changed by the sender
+        alignas(64) std::atomic<uint32_t> tail{0}; //!< read counter,  only changed by the receiver
+    };
+
+    /** the header at the start of a mailbox,  it is followed by the rings*/
+    struct MailboxHeader {
+        std::atomic<uint32_t> magic{0}; //!< marker set once the mailbox has been initialized
+        uint32_t ringSize{0}; //!< the size of the data section of each ring (power of 2)
+        std::atomic<int32_t> state{0}; //!< the current mailbox_state_t
+        std::atomic<uint32_t> ringsInUse{0}; //!< one past the highest ring ever claimed
+        std::atomic<uint32_t> closeRequest{0}; //!< set to ask the receiver to stop
+        alignas(64) std::atomic<uint32_t> doorbell{0}; //!< the value the receiver sleeps on
+        std::atomic<uint32_t> sleeping{0}; //!< set while the receiver is waiting on the doorbell
+    };
+
+    /** class implementing a mailbox owned and read by a single receiver*/
+    class OwnedMailbox {
+      private:
+        std::unique_ptr<boost::interprocess::shared_memory_object> memory;
+        std::unique_ptr<boost::interprocess::mapped_region> region;
+        MailboxHeader* header{nullptr};
+        char* rings{nullptr};
+        std::string connectionName;
+        std::string errorString;
+        uint32_t currentRing{0}; //!< the ring being read
+        int readsOnRing{0}; //!< the number of messages read from the current ring
+        bool connected{false};
+
+      public:
+        OwnedMailbox() = default;
+        ~OwnedMailbox();
+        /** create the mailbox,  removing any stale mailbox of the same name*/
+        bool connect(const std::string& connection, uint32_t ringSize);
+        /** change the state of the mailbox*/
+        void changeState(mailbox_state_t newState);
+        /** get a message,  waiting for up to timeout if none are available
+        @details spins for a short period before sleeping on the mailbox doorbell*/
+        stx::optional<ActionMessage> getMessage(std::chrono::milliseconds timeout);
+        /** check if another process has asked the receiver to stop*/
+        bool closeRequested() const;
+        const std::string& getError() const { return errorString; }
+
+      private:
+        /** read the next available message from any ring without waiting*/
+        stx::optional<ActionMessage> tryGetMessage();
+    };
+
+    /** class implementing a connection to a mailbox for transmitting data
+    @details each sender claims its own ring in the mailbox so no locks are needed to send*/
+    class MailboxSender {
+      private:
+        std::unique_ptr<boost::interprocess::shared_memory_object> memory;
+        std::unique_ptr<boost::interprocess::mapped_region> region;
+        MailboxHeader* header{nullptr};
+        RingControl* ring{nullptr};
+        char* data{nullptr};
+        std::string errorString;
+        uint32_t mask{0};
+
+      public:
+        MailboxSender() = default;
+        MailboxSender(MailboxSender&& other) noexcept;
+        MailboxSender& operator=(MailboxSender&& other) noexcept;
+        ~MailboxSender();
+        /** open a mailbox and claim a ring in it
+        @details a ring still claimed by a process that no longer exists is taken over*/
+        bool connect(const std::string& connection, int retries);
+        /** serialize a message directly into the ring,  waiting if the ring is full
+        @return false if the message could not be delivered*/
+        bool sendMessage(const ActionMessage& cmd);
+        const std::string& getError() const { return errorString; }
+        /** ask the receiver of a mailbox to stop without claiming a ring*/
+        static bool requestClose(const std::string& connection);
+
+      private:
+        void release();
+    };
+} // namespace shm
+} // namespace helics
@@ -18,6 +18,17 @@ SPDX-License-Identifier: BSD-3-Clause
 namespace helics {
 template class NetworkBroker<tcp::TcpComms, interface_type::tcp, static_cast<int>(core_type::TCP)>;
 namespace tcp {
+    TcpBroker::TcpBroker(bool rootBroker) noexcept: NetworkBroker(rootBroker) {}
+
+    TcpBroker::TcpBroker(const std::string& broker_name): NetworkBroker(broker_name) {}
+
+    std::shared_ptr<helicsCLI11App> TcpBroker::generateCLI()
+    {
+        auto hApp = NetworkBroker::generateCLI();
+        netInfo.addTcpBatchingOptions(*hApp);
+        return hApp;
+    }
+
     TcpBrokerSS::TcpBrokerSS(bool rootBroker) noexcept: NetworkBroker(rootBroker) {}
 
     TcpBrokerSS::TcpBrokerSS(const std::string& broker_name): NetworkBroker(broker_name) {}
@@ -17,9 +17,17 @@ namespace helics {
 namespace tcp {
     class TcpComms;
     class TcpCommsSS;
-    /** implementation for the core that uses TCP messages to communicate*/
-    using TcpBroker =
-        NetworkBroker<TcpComms, interface_type::tcp, static_cast<int>(core_type::TCP)>;
+    /** implementation for the broker that uses TCP messages to communicate*/
+    class TcpBroker final:
+        public NetworkBroker<TcpComms, interface_type::tcp, static_cast<int>(core_type::TCP)> {
+      public:
+        /** default constructor*/
+        explicit TcpBroker(bool rootBroker = false) noexcept;
+        explicit TcpBroker(const std::string& broker_name);
+
+      protected:
+        virtual std::shared_ptr<helicsCLI11App> generateCLI() override;
+    };
 
     /** single socket version of the TCP broker*/
     class TcpBrokerSS final:
@@ -13,8 +13,11 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "TcpCommsCommon.h"
 #include "TcpHelperClasses.h"
 
+#include <chrono>
 #include <map>
 #include <memory>
+#include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -34,6 +37,8 @@ namespace tcp {
             return;
         }
         reuse_address = netInfo.reuse_address;
+        txBatchBytes = netInfo.txBatchBytes;
+        txLinger = netInfo.txLinger;
         propertyUnLock();
     }
 
@@ -255,6 +260,7 @@ namespace tcp {
                 m.messageID = (PortNumber <= 0) ? REQUEST_PORTS : CONNECTION_REQUEST;
 
                 m.setStringData(brokerName, brokerInitString);
+                addEncodingRequest(m);
                 try {
                     brokerConnection->send(m.packetize());
                 }
@@ -279,6 +285,7 @@ namespace tcp {
                     if (isProtocolCommand(mess->second)) {
                         if (mess->second.messageID == PORT_DEFINITIONS) {
                             if (PortNumber <= 0) {
+                                checkEncodingReply(mess->second);
                                 rxMessageQueue.push(mess->second);
                                 connectionEstablished = true;
                                 continue;
@@ -286,6 +293,7 @@ namespace tcp {
                         }
                         if (mess->second.messageID == CONNECTION_ACK) {
                             if (PortNumber > 0) {
+                                checkEncodingReply(mess->second);
                                 connectionEstablished = true;
                                 continue;
                             }
@@ -364,16 +372,87 @@ namespace tcp {
         }
         setTxStatus(connection_status::connected);
 
-        //  std::vector<ActionMessage> txlist;
-        bool processing{true};
-        while (processing) {
-            route_id rid;
-            ActionMessage cmd;
+        /** the packets waiting to be written to a connection,  the packet strings are reused
+        between batches so the storage is only allocated once*/
+        struct txBatch {
+            std::vector<std::string> packets;
+            std::size_t count{0};
+            bool containsDisconnect{false};
+            bool noDelay{false};
+        };
+        std::map<route_id, txBatch> batches;
+        std::vector<asio::const_buffer> buffers;
+        std::size_t pendingBytes{0};
 
-            std::tie(rid, cmd) = txQueue.pop();
-            bool processed = false;
+        auto flushBatches = [&]() {
+            for (auto& bt : batches) {
+                auto& batch = bt.second;
+                if (batch.count == 0) {
+                    continue;
+                }
+                TcpConnection::pointer connection;
+                if (bt.first == parent_route_id) {
+                    connection = brokerConnection;
+                } else {
+                    auto rt_find = routes.find(bt.first);
+                    if (rt_find != routes.end()) {
+                        connection = rt_find->second;
+                    }
+                }
+                if (connection) {
+                    buffers.clear();
+                    for (std::size_t ii = 0; ii < batch.count; ++ii) {
+                        buffers.push_back(asio::buffer(batch.packets[ii]));
+                    }
+                    try {
+                        connection->send(buffers);
+                        if (!batch.noDelay && txBatchBytes > 0) {
+                            // the batching does the coalescing so don't let Nagle hold the tail
+                            batch.noDelay = connection->setNoDelay(true);
+                        }
+                    }
+                    catch (const std::system_error& se) {
+                        if (se.code() != asio::error::connection_aborted) {
+                            if (!batch.containsDisconnect) {
+                                logError(
+                                    ((bt.first == parent_route_id) ?
+                                         std::string("broker send ") :
+                                         std::string("rt send ") +
+                                             std::to_string(bt.first.baseValue())) +
+                                    "::" + se.what());
+                            }
+                        }
+                    }
+                }
+                batch.count = 0;
+                batch.containsDisconnect = false;
+            }
+            pendingBytes = 0;
+        };
+
+        auto addToBatch = [&](route_id target, const ActionMessage& cmd) {
+            auto& batch = batches[target];
+            if (batch.count == batch.packets.size()) {
+                batch.packets.emplace_back();
+            }
+            auto& packet = batch.packets[batch.count++];
+            if (useCompactEncoding(target, cmd)) {
+                cmd.packetize_compact(packet);
+            } else {
+                cmd.packetize(packet);
+            }
+            pendingBytes += packet.size();
+            if (isDisconnectCommand(cmd)) {
+                batch.containsDisconnect = true;
+            }
+        };
+
+        bool processing{true};
+        auto processTx = [&](route_id rid, ActionMessage& cmd) {
             if (isProtocolCommand(cmd)) {
                 if (rid == control_route) {
+                    // changes to the routes apply after the messages already queued
+                    flushBatches();
                     switch (cmd.messageID) {
                         case NEW_ROUTE: {
                             auto& newroute = cmd.payload;
@@ -391,88 +470,64 @@ namespace tcp {
                             catch (std::exception&) {
                                 // TODO(PT):: do something???
                             }
-                            processed = true;
-                        } break;
+                            return;
+                        }
                         case REMOVE_ROUTE:
                             routes.erase(route_id{cmd.getExtraData()});
-                            processed = true;
-                            break;
+                            batches.erase(route_id{cmd.getExtraData()});
+                            return;
                         case CLOSE_RECEIVER:
                             rxMessageQueue.push(cmd);
-                            processed = true;
-                            break;
+                            return;
                         case DISCONNECT:
                             processing = false;
-                            processed = true;
-                            break;
+                            return;
                     }
                 }
             }
-            if (processed) {
-                continue;
-            }
 
+            if (!checkEncoding(cmd)) {
+                return;
+            }
             if (rid == parent_route_id) {
                 if (hasBroker) {
-                    try {
-                        brokerConnection->send(cmd.packetize());
-                    }
-                    catch (const std::system_error& se) {
-                        if (se.code() != asio::error::connection_aborted) {
-                            if (!isDisconnectCommand(cmd)) {
-                                logError(
-                                    std::string("broker send 0 ") +
-                                    actionMessageType(cmd.action()) + ':' + se.what());
-                            }
-                        }
-                    }
-
-                    // if (error)
-                    {
-                        //     std::cerr << "transmit failure to broker " << error.message() << '\n';
-                    }
+                    addToBatch(parent_route_id, cmd);
                 }
             } else if (rid == control_route) { // send to rx thread loop
                 rxMessageQueue.push(cmd);
-            } else {
-                //  txlist.push_back(cmd);
-                auto rt_find = routes.find(rid);
-                if (rt_find != routes.end()) {
-                    try {
-                        rt_find->second->send(cmd.packetize());
-                    }
-                    catch (const std::system_error& se) {
-                        if (se.code() != asio::error::connection_aborted) {
-                            if (!isDisconnectCommand(cmd)) {
-                                logError(
-                                    std::string("rt send ") + std::to_string(rid.baseValue()) +
-                                    "::" + se.what());
-                            }
-                        }
-                    }
-                } else {
-                    if (hasBroker) {
-                        try {
-                            brokerConnection->send(cmd.packetize());
-                        }
-                        catch (const std::system_error& se) {
-                            if (se.code() != asio::error::connection_aborted) {
-                                if (!isDisconnectCommand(cmd)) {
-                                    logError(
-                                        std::string("broker send") +
-                                        std::to_string(rid.baseValue()) + " ::" + se.what());
-                                }
-                            }
-                        }
-                    } else {
-                        if (!isDisconnectCommand(cmd)) {
-                            logWarning(
-                                std::string("(tcp) unknown message destination message dropped ") +
-                                prettyPrintString(cmd));
-                        }
+            } else if (routes.find(rid) != routes.end()) {
+                addToBatch(rid, cmd);
+            } else if (hasBroker) {
+                addToBatch(parent_route_id, cmd);
+            } else if (!isDisconnectCommand(cmd)) {
+                logWarning(
+                    std::string("(tcp) unknown message destination message dropped ") +
+                    prettyPrintString(cmd));
+            }
+        };
+
+        const auto batchLimit = static_cast<std::size_t>(txBatchBytes);
+        while (processing) {
+            route_id rid;
+            ActionMessage cmd;
+
+            std::tie(rid, cmd) = txQueue.pop();
+            processTx(rid, cmd);
+            // drain whatever else is queued into the batches
+            bool lingered{txLinger <= 0};
+            while (processing && pendingBytes > 0 && pendingBytes < batchLimit) {
+                auto next = txQueue.try_pop();
+                if (!next) {
+                    if (lingered) {
+                        break;
                     }
+                    std::this_thread::sleep_for(std::chrono::microseconds(txLinger));
+                    lingered = true;
+                    continue;
                 }
+                processTx(next->first, next->second);
             }
+            flushBatches();
         }
         for (auto& rt : routes) {
             rt.second->close();
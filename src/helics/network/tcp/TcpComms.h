@@ -37,6 +37,8 @@ namespace tcp {
 
       private:
         bool reuse_address = false;
+        int txBatchBytes{64 * 1024}; //!< the maximum number of bytes to combine into a single write
+        int txLinger{0}; //!< microseconds to wait for more messages before writing a partial batch
         virtual int getDefaultBrokerPort() const override;
         virtual void queue_rx_function() override; //!< the functional loop for the receive queue
         virtual void queue_tx_function() override; //!< the loop for transmitting data
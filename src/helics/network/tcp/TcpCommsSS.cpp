@@ -340,7 +340,7 @@ namespace tcp {
                     }
                 }
             }
-            if (processed) {
+            if (processed || !checkEncoding(cmd)) {
                 continue;
             }
 
@@ -17,6 +17,17 @@ SPDX-License-Identifier: BSD-3-Clause
 namespace helics {
 template class NetworkCore<tcp::TcpComms, interface_type::tcp>;
 namespace tcp {
+    TcpCore::TcpCore() noexcept {}
+
+    TcpCore::TcpCore(const std::string& coreName): NetworkCore(coreName) {}
+
+    std::shared_ptr<helicsCLI11App> TcpCore::generateCLI()
+    {
+        auto hApp = NetworkCore::generateCLI();
+        netInfo.addTcpBatchingOptions(*hApp);
+        return hApp;
+    }
+
     TcpCoreSS::TcpCoreSS() noexcept {}
 
     TcpCoreSS::TcpCoreSS(const std::string& coreName): NetworkCore(coreName) {}
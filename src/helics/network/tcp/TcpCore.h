@@ -17,7 +17,15 @@ namespace tcp {
     class TcpComms;
     class TcpCommsSS;
     /** implementation for the core that uses tcp messages to communicate*/
-    using TcpCore = NetworkCore<TcpComms, interface_type::tcp>;
+    class TcpCore final: public NetworkCore<TcpComms, interface_type::tcp> {
+      public:
+        /** default constructor*/
+        TcpCore() noexcept;
+        explicit TcpCore(const std::string& coreName);
+
+      protected:
+        virtual std::shared_ptr<helicsCLI11App> generateCLI() override;
+    };
 
     /** implementation for the core that uses tcp messages to communicate*/
     class TcpCoreSS final: public NetworkCore<TcpCommsSS, interface_type::tcp> {
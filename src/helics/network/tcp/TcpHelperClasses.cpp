@@ -8,6 +8,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "TcpHelperClasses.h"
 
 #include <algorithm>
+#include <asio/write.hpp>
 #include <iostream>
 #include <thread>
 #include <utility>
@@ -281,6 +282,28 @@ namespace tcp {
         return sz;
     }
 
+    size_t TcpConnection::send(const std::vector<asio::const_buffer>& buffers)
+    {
+        if (!isConnected()) {
+            if (!waitUntilConnected(300ms)) {
+                std::cerr << "connection timeout waiting again" << std::endl;
+            }
+            if (!waitUntilConnected(200ms)) {
+                std::cerr << "connection timeout twice, now returning" << std::endl;
+                return 0;
+            }
+        }
+        // asio::write continues until all the buffers are written
+        return asio::write(socket_, buffers);
+    }
+
+    bool TcpConnection::setNoDelay(bool noDelay)
+    {
+        std::error_code ec;
+        socket_.set_option(tcp::no_delay(noDelay), ec);
+        return !ec;
+    }
+
     size_t TcpConnection::receive(void* buffer, size_t maxDataSize)
     {
         return socket_.receive(asio::buffer(buffer, maxDataSize));
@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../../common/GuardedTypes.hpp"
 #include "gmlc/concurrency/TriggerVariable.hpp"
 
+#include <asio/buffer.hpp>
 #include <asio/io_context.hpp>
 #include <asio/ip/tcp.hpp>
 #include <functional>
@@ -74,6 +75,13 @@ namespace tcp {
         /** send a string
     @throws std::system_error on failure*/
         size_t send(const std::string& dataString);
+        /** send a set of buffers with a single vectored write
+    @throws std::system_error on failure*/
+        size_t send(const std::vector<asio::const_buffer>& buffers);
+        /** enable or disable the Nagle algorithm on the connection
+    @details the socket must be connected for the option to take effect
+    @return true if the option was set*/
+        bool setNoDelay(bool noDelay);
 
         /** do a blocking receive on the socket
     @throw std::system_error on failure
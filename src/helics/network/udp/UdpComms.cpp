@@ -12,13 +12,21 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "../NetworkBrokerData.hpp"
 #include "../networkDefaults.hpp"
 
+#include <algorithm>
+#include <array>
 #include <asio/ip/udp.hpp>
+#include <cerrno>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#ifdef __linux__
+#    include <sys/socket.h>
+#endif
+
 namespace helics {
 namespace udp {
     using asio::ip::udp;
@@ -40,9 +48,22 @@ namespace udp {
 
         promisePort = std::promise<int>();
         futurePort = promisePort.get_future();
-
+        batching = netInfo.udpBatching;
+        datagramSize = netInfo.udpDatagramSize;
         propertyUnLock();
     }
+
+    void UdpComms::setFlag(const std::string& flag, bool val)
+    {
+        if (flag == "batching") {
+            if (propertyLock()) {
+                batching = val;
+                propertyUnLock();
+            }
+        } else {
+            NetworkCommsInterface::setFlag(flag, val);
+        }
+    }
     /** destructor*/
     UdpComms::~UdpComms() { disconnect(); }
 
@@ -51,6 +72,70 @@ namespace udp {
         return (net != interface_networks::ipv6) ? udp::v4() : udp::v6();
     }
 
+    /** the size of the receive buffer for a single datagram*/
+    static constexpr std::size_t rxBufferSize{10192};
+    /** the requested socket receive buffer size when batching,  the OS may limit this*/
+    static constexpr int rxSocketBufferSize{4 * 1024 * 1024};
+#ifdef __linux__
+    /** the maximum number of datagrams handled in a single sendmmsg or recvmmsg call*/
+    static constexpr std::size_t mmsgBatchSize{32};
+#endif
+
+    /** a datagram waiting to be sent*/
+    struct datagram {
+        const udp::endpoint* target{nullptr};
+        std::string data;
+    };
+
+    /** send a set of datagrams using as few system calls as possible
+    @return the index of the first datagram not sent,  if error is set this is the datagram that failed*/
+    static std::size_t sendDatagrams(
+        udp::socket& socket,
+        const std::vector<datagram>& datagrams,
+        std::size_t start,
+        std::size_t count,
+        std::error_code& error)
+    {
+        error.clear();
+#ifdef __linux__
+        std::array<mmsghdr, mmsgBatchSize> headers;
+        std::array<iovec, mmsgBatchSize> vecs;
+        while (start < count) {
+            auto batch = std::min(count - start, mmsgBatchSize);
+            for (std::size_t ii = 0; ii < batch; ++ii) {
+                const auto& gram = datagrams[start + ii];
+                vecs[ii].iov_base = const_cast<char*>(gram.data.data());
+                vecs[ii].iov_len = gram.data.size();
+                std::memset(&headers[ii], 0, sizeof(mmsghdr));
+                headers[ii].msg_hdr.msg_name =
+                    const_cast<void*>(static_cast<const void*>(gram.target->data()));
+                headers[ii].msg_hdr.msg_namelen = static_cast<socklen_t>(gram.target->size());
+                headers[ii].msg_hdr.msg_iov = &vecs[ii];
+                headers[ii].msg_hdr.msg_iovlen = 1;
+            }
+            auto res = ::sendmmsg(
+                socket.native_handle(), headers.data(), static_cast<unsigned int>(batch), 0);
+            if (res < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                error = std::error_code(errno, std::system_category());
+                return start;
+            }
+            start += static_cast<std::size_t>(res);
+        }
+#else
+        for (; start < count; ++start) {
+            const auto& gram = datagrams[start];
+            socket.send_to(asio::buffer(gram.data), *gram.target, 0, error);
+            if (error) {
+                return start;
+            }
+        }
+#endif
+        return start;
+    }
+
     void UdpComms::queue_rx_function()
     {
         if (PortNumber < 0) {
@@ -122,42 +207,121 @@ namespace udp {
             }
         }
 
-        std::vector<char> data(10192);
-        udp::endpoint remote_endp;
         std::error_code error;
         std::error_code ignored_error;
-        setRxStatus(connection_status::connected);
-        while (true) {
-            auto len = socket.receive_from(asio::buffer(data), remote_endp, 0, error);
-            if (error) {
-                setRxStatus(connection_status::error);
-                return;
+        // process a single message,  returns false if the receiver should close
+        auto processMessage = [&](ActionMessage&& M, const udp::endpoint& remote_endp) {
+            if (!isValidCommand(M)) {
+                logWarning("invalid command received udp");
+                return true;
             }
+            if (isProtocolCommand(M)) {
+                if (M.messageID == CLOSE_RECEIVER) {
+                    return false;
+                }
+                auto reply = generateReplyToIncomingMessage(M);
+                if (reply.messageID == DISCONNECT) {
+                    return false;
+                }
+                if (reply.action() != CMD_IGNORE) {
+                    socket.send_to(asio::buffer(reply.to_string()), remote_endp, 0, ignored_error);
+                }
+            } else {
+                ActionCallback(std::move(M));
+            }
+            return true;
+        };
+        // process a datagram which may contain several packed messages
+        auto processDatagram = [&](const char* data, std::size_t len, const udp::endpoint& remote) {
             if (len == 5) {
-                std::string str(data.data(), len);
+                std::string str(data, len);
                 if (str == "close") {
-                    goto CLOSE_RX_LOOP;
+                    return false;
                 }
             }
-            ActionMessage M(data.data(), len);
-            if (!isValidCommand(M)) {
-                logWarning("invalid command received udp");
-                continue;
+            ActionMessage M;
+            auto used = M.depacketize(data, static_cast<int>(len));
+            if (used <= 0) {
+                return processMessage(ActionMessage(data, len), remote);
             }
-            if (isProtocolCommand(M)) {
-                if (M.messageID == CLOSE_RECEIVER) {
-                    goto CLOSE_RX_LOOP;
-                } else {
-                    auto reply = generateReplyToIncomingMessage(M);
-                    if (reply.messageID == DISCONNECT) {
+            std::size_t offset{0};
+            while (used > 0) {
+                if (!processMessage(std::move(M), remote)) {
+                    return false;
+                }
+                offset += static_cast<std::size_t>(used);
+                if (offset >= len) {
+                    break;
+                }
+                M = ActionMessage();
+                used = M.depacketize(data + offset, static_cast<int>(len - offset));
+            }
+            if (offset < len) {
+                logWarning("incomplete packed datagram received udp");
+            }
+            return true;
+        };
+        if (batching) {
+            // packed datagrams arrive in bursts so ask for more room in the socket buffer
+            socket.set_option(udp::socket::receive_buffer_size(rxSocketBufferSize), ignored_error);
+        }
+        setRxStatus(connection_status::connected);
+#ifdef __linux__
+        if (batching) {
+            std::vector<char> data(rxBufferSize * mmsgBatchSize);
+            std::array<mmsghdr, mmsgBatchSize> headers;
+            std::array<iovec, mmsgBatchSize> vecs;
+            std::array<sockaddr_storage, mmsgBatchSize> addresses;
+            udp::endpoint remote_endp;
+            while (true) {
+                for (std::size_t ii = 0; ii < mmsgBatchSize; ++ii) {
+                    vecs[ii].iov_base = data.data() + ii * rxBufferSize;
+                    vecs[ii].iov_len = rxBufferSize;
+                    std::memset(&headers[ii], 0, sizeof(mmsghdr));
+                    headers[ii].msg_hdr.msg_name = &addresses[ii];
+                    headers[ii].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+                    headers[ii].msg_hdr.msg_iov = &vecs[ii];
+                    headers[ii].msg_hdr.msg_iovlen = 1;
+                }
+                // block for the first datagram then take whatever else is already available
+                auto cnt = ::recvmmsg(
+                    socket.native_handle(),
+                    headers.data(),
+                    static_cast<unsigned int>(mmsgBatchSize),
+                    MSG_WAITFORONE,
+                    nullptr);
+                if (cnt < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    setRxStatus(connection_status::error);
+                    return;
+                }
+                for (int ii = 0; ii < cnt; ++ii) {
+                    auto namelen = std::min<std::size_t>(
+                        headers[ii].msg_hdr.msg_namelen, remote_endp.capacity());
+                    std::memcpy(remote_endp.data(), &addresses[ii], namelen);
+                    remote_endp.resize(namelen);
+                    if (!processDatagram(
+                            data.data() + ii * rxBufferSize, headers[ii].msg_len, remote_endp)) {
                         goto CLOSE_RX_LOOP;
-                    } else if (reply.action() != CMD_IGNORE) {
-                        socket.send_to(
-                            asio::buffer(reply.to_string()), remote_endp, 0, ignored_error);
                     }
                 }
-            } else {
-                ActionCallback(std::move(M));
+            }
+        }
+#endif
+        {
+            std::vector<char> data(rxBufferSize);
+            udp::endpoint remote_endp;
+            while (true) {
+                auto len = socket.receive_from(asio::buffer(data), remote_endp, 0, error);
+                if (error) {
+                    setRxStatus(connection_status::error);
+                    return;
+                }
+                if (!processDatagram(data.data(), len, remote_endp)) {
+                    goto CLOSE_RX_LOOP;
+                }
             }
         }
     CLOSE_RX_LOOP:
@@ -202,6 +366,7 @@ namespace udp {
                     ActionMessage m(CMD_PROTOCOL_PRIORITY);
                     m.messageID = (PortNumber <= 0) ? REQUEST_PORTS : CONNECTION_REQUEST;
                     m.setStringData(brokerName, brokerInitString);
+                    addEncodingRequest(m);
                     transmitSocket.send_to(asio::buffer(m.to_string()), broker_endpoint, 0, error);
                     if (error) {
                         logError(
@@ -260,6 +425,7 @@ namespace udp {
                             connectionEstablished = true;
                         } else if (m.messageID == CONNECTION_ACK) {
                             if (PortNumber.load() > 0) {
+                                checkEncodingReply(m);
                                 connectionEstablished = true;
                                 continue;
                             }
@@ -324,12 +490,65 @@ namespace udp {
 
         setTxStatus(connection_status::connected);
 
-        while (true) {
-            route_id rid;
-            ActionMessage cmd;
+        // the datagram storage is reused between batches
+        std::vector<datagram> datagrams;
+        std::size_t datagramCount{0};
+        std::map<const udp::endpoint*, std::size_t> openDatagrams;
+        std::string packet;
+        const auto maxDatagram = static_cast<std::size_t>(datagramSize);
+        constexpr std::size_t maxPendingDatagrams{256};
 
-            std::tie(rid, cmd) = txQueue.pop();
-            bool processed = false;
+        auto flushDatagrams = [&]() {
+            std::size_t pos{0};
+            while (pos < datagramCount) {
+                pos = sendDatagrams(transmitSocket, datagrams, pos, datagramCount, error);
+                if (error) {
+                    logWarning(fmt::format(
+                        "transmit failure sending to {}:{} {}",
+                        datagrams[pos].target->address().to_string(),
+                        datagrams[pos].target->port(),
+                        error.message()));
+                    ++pos;
+                }
+            }
+            datagramCount = 0;
+            openDatagrams.clear();
+        };
+        auto newDatagram = [&](const udp::endpoint& target) -> std::string& {
+            if (datagramCount == datagrams.size()) {
+                datagrams.emplace_back();
+            }
+            auto& gram = datagrams[datagramCount++];
+            gram.target = &target;
+            return gram.data;
+        };
+        auto addMessage = [&](const udp::endpoint& target, bool compact, const ActionMessage& cmd) {
+            if (!batching) {
+                if (compact) {
+                    cmd.to_compact_string(newDatagram(target));
+                } else {
+                    cmd.to_string(newDatagram(target));
+                }
+                return;
+            }
+            // packed messages carry the packet framing so the receiver can separate them
+            if (compact) {
+                cmd.packetize_compact(packet);
+            } else {
+                cmd.packetize(packet);
+            }
+            auto open = openDatagrams.find(&target);
+            if (open != openDatagrams.end() &&
+                datagrams[open->second].data.size() + packet.size() <= maxDatagram) {
+                datagrams[open->second].data.append(packet);
+            } else {
+                openDatagrams[&target] = datagramCount;
+                newDatagram(target).assign(packet);
+            }
+        };
+
+        bool processing{true};
+        auto processTx = [&](route_id rid, ActionMessage& cmd) {
             if (isProtocolCommand(cmd)) {
                 if (rid == control_route) {
                     switch (cmd.messageID) {
@@ -348,13 +567,15 @@ namespace udp {
                             catch (std::exception&) {
                                 // TODO(someone): do something???
                             }
-                            processed = true;
-                        } break;
+                            return;
+                        }
                         case REMOVE_ROUTE:
+                            // pending datagrams refer to the route endpoints
+                            flushDatagrams();
                             routes.erase(route_id{cmd.getExtraData()});
-                            processed = true;
-                            break;
+                            return;
                         case CLOSE_RECEIVER:
+                            flushDatagrams();
                             transmitSocket.send_to(
                                 asio::buffer(cmd.to_string()), rxEndpoint, 0, error);
                             if (error) {
@@ -363,68 +584,59 @@ namespace udp {
                                     error.message()));
                             }
                             closingRx = true;
-                            processed = true;
-                            break;
+                            return;
                         case DISCONNECT:
-                            goto CLOSE_TX_LOOP; // break out of loop
+                            processing = false;
+                            return;
                     }
                 }
             }
-            if (processed) {
-                continue;
-            }
 
+            if (!checkEncoding(cmd)) {
+                return;
+            }
             if (rid == parent_route_id) {
                 if (hasBroker) {
-                    transmitSocket.send_to(
-                        asio::buffer(cmd.to_string()), broker_endpoint, 0, error);
-                    if (error) {
-                        logWarning(
-                            fmt::format("transmit failure sending to broker  {}", error.message()));
-                    }
+                    addMessage(broker_endpoint, useCompactEncoding(rid, cmd), cmd);
                 } else {
                     logWarning(fmt::format(
                         "message directed to broker of comm system with no broker, message dropped {}",
                         prettyPrintString(cmd)));
                 }
             } else if (rid == control_route) { // send to rx thread loop
-                transmitSocket.send_to(asio::buffer(cmd.to_string()), rxEndpoint, 0, error);
-                if (error) {
-                    logWarning(fmt::format(
-                        "transmit failure sending control message to receiver  {}",
-                        error.message()));
-                }
+                addMessage(rxEndpoint, false, cmd);
             } else {
                 auto rt_find = routes.find(rid);
                 if (rt_find != routes.end()) {
-                    transmitSocket.send_to(
-                        asio::buffer(cmd.to_string()), rt_find->second, 0, error);
-                    if (error) {
-                        logWarning(fmt::format(
-                            "transmit failure sending to route {}:{}",
-                            rid.baseValue(),
-                            error.message()));
-                    }
-                } else {
-                    if (hasBroker) {
-                        transmitSocket.send_to(
-                            asio::buffer(cmd.to_string()), broker_endpoint, 0, error);
-                        if (error) {
-                            logWarning(fmt::format(
-                                "transmit failure sending to broker  {}", error.message()));
-                        }
-                    } else {
-                        if (!isDisconnectCommand(cmd)) {
-                            logWarning(
-                                std::string("(udp) unknown route, message dropped ") +
-                                prettyPrintString(cmd));
-                        }
+                    addMessage(rt_find->second, useCompactEncoding(rid, cmd), cmd);
+                } else if (hasBroker) {
+                    addMessage(broker_endpoint, useCompactEncoding(parent_route_id, cmd), cmd);
+                } else if (!isDisconnectCommand(cmd)) {
+                    logWarning(
+                        std::string("(udp) unknown route, message dropped ") +
+                        prettyPrintString(cmd));
+                }
+            }
+        };
+
+        while (processing) {
+            route_id rid;
+            ActionMessage cmd;
+
+            std::tie(rid, cmd) = txQueue.pop();
+            processTx(rid, cmd);
+            if (batching) {
+                // pack whatever else is already queued before sending
+                while (processing && datagramCount < maxPendingDatagrams) {
+                    auto next = txQueue.try_pop();
+                    if (!next) {
+                        break;
                     }
+                    processTx(next->first, next->second);
                 }
             }
+            flushDatagrams();
         }
-    CLOSE_TX_LOOP:
-
         routes.clear();
         if (getRxStatus() == connection_status::connected) {
             if (closingRx) {
@@ -29,7 +29,11 @@ namespace udp {
 
         virtual void loadNetworkInfo(const NetworkBrokerData& netInfo) override;
 
+        virtual void setFlag(const std::string& flag, bool val) override;
+
       private:
+        bool batching{false}; //!< pack messages into datagrams and use batched system calls
+        int datagramSize{1472}; //!< the maximum size of a datagram of packed messages
         virtual int getDefaultBrokerPort() const override;
         virtual void queue_rx_function() override; //!< the functional loop for the receive queue
         virtual void queue_tx_function() override; //!< the loop for transmitting data
@@ -486,7 +486,18 @@ namespace zeromq {
             if (processed) {
                 continue;
             }
-            cmd.to_vector(buffer);
+            if (!checkEncoding(cmd)) {
+                continue;
+            }
+            // messages on unknown routes go to the broker so use the broker encoding for those
+            if (rid != control_route &&
+                useCompactEncoding(
+                    (routes.find(rid) != routes.end()) ? rid : parent_route_id, cmd)) {
+                buffer.resize(cmd.compactByteCount());
+                cmd.toCompactByteArray(buffer.data(), static_cast<int>(buffer.size()));
+            } else {
+                cmd.to_vector(buffer);
+            }
             if (rid == parent_route_id) {
                 if (hasBroker) {
                     brokerPushSocket.send(
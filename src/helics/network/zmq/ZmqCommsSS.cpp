@@ -383,7 +383,7 @@ namespace zeromq {
                         }
                     }
                 }
-                if (!processed) {
+                if (!processed && checkEncoding(cmd)) {
                     buffer.clear();
                     cmd.to_vector(buffer);
                     if (rid == parent_route_id) {
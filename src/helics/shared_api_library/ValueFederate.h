@@ -288,6 +288,51 @@ HELICS_EXPORT void helicsFederateRegisterFromPublicationJSON(helics_federate fed
  */
 HELICS_EXPORT void helicsFederatePublishJSON(helics_federate fed, const char* json, helics_error* err);
 
+/**
+ * Publish double values on several publications of a federate in a single operation.
+ *
+ * @details Each value is converted to the type of its publication and the change detection of the publication is
+ * applied as in helicsPublicationPublishDouble,  the values are then passed to the core together.
+ *
+ * @param fed The federate the publications belong to.
+ * @param pubs An array of publications to publish on.
+ * @param values An array of the values to publish,  one for each publication.
+ * @param count The number of publications and values.
+ * @forcpponly
+ * @param[in,out] err A pointer to an error object for catching errors.
+ * @endforcpponly
+ */
+HELICS_EXPORT void helicsFederatePublishBatchDouble(
+    helics_federate fed,
+    const helics_publication* pubs,
+    const double* values,
+    int count,
+    helics_error* err);
+
+/**
+ * Get the double values of several inputs of a federate in a single operation.
+ *
+ * @details The values match calling helicsInputGetDouble on each input,  inputs of double type without change
+ * detection or unit conversion are decoded directly from the received data.
+ *
+ * @param fed The federate the inputs belong to.
+ * @param inputs An array of inputs to get the values of.
+ * @param[out] values An array to store the values in,  one for each input.
+ * @param[out] updated An optional bitmask array of at least (count+63)/64 elements,  bit i%64 of element i/64 is set if
+ * input i was updated since it was last read,  may be NULL.
+ * @param count The number of inputs and values.
+ * @forcpponly
+ * @param[in,out] err A pointer to an error object for catching errors.
+ * @endforcpponly
+ */
+HELICS_EXPORT void helicsFederateGetBatchDouble(
+    helics_federate fed,
+    const helics_input* inputs,
+    double values[],
+    uint64_t updated[],
+    int count,
+    helics_error* err);
+
 /**
  * \defgroup publications Publication functions
  * @details Functions for publishing data of various kinds.
@@ -366,6 +366,81 @@ void helicsFederatePublishJSON(helics_federate fed, const char* json, helics_err
     }
 }
 
+static constexpr char invalidBatchArrays[] = "the publication and value arrays must not be null";
+
+void helicsFederatePublishBatchDouble(
+    helics_federate fed,
+    const helics_publication* pubs,
+    const double* values,
+    int count,
+    helics_error* err)
+{
+    auto fedObj = getValueFedSharedPtr(fed, err);
+    if (!fedObj || count <= 0) {
+        return;
+    }
+    if ((pubs == nullptr) || (values == nullptr)) {
+        if (err != nullptr) {
+            err->error_code = helics_error_invalid_argument;
+            err->message = invalidBatchArrays;
+        }
+        return;
+    }
+    std::vector<helics::Publication*> pubPtrs;
+    pubPtrs.reserve(count);
+    for (int ii = 0; ii < count; ++ii) {
+        auto* pubObj = verifyPublication(pubs[ii], err);
+        if (pubObj == nullptr) {
+            return;
+        }
+        pubPtrs.push_back(pubObj->pubPtr);
+    }
+    try {
+        fedObj->publishBatch(pubPtrs, std::vector<double>(values, values + count));
+    }
+    catch (...) {
+        helicsErrorHandler(err);
+    }
+}
+
+static constexpr char invalidInputBatchArrays[] = "the input and value arrays must not be null";
+
+void helicsFederateGetBatchDouble(
+    helics_federate fed,
+    const helics_input* inputs,
+    double values[],
+    uint64_t updated[],
+    int count,
+    helics_error* err)
+{
+    auto fedObj = getValueFedSharedPtr(fed, err);
+    if (!fedObj || count <= 0) {
+        return;
+    }
+    if ((inputs == nullptr) || (values == nullptr)) {
+        if (err != nullptr) {
+            err->error_code = helics_error_invalid_argument;
+            err->message = invalidInputBatchArrays;
+        }
+        return;
+    }
+    std::vector<helics::Input*> inpPtrs;
+    inpPtrs.reserve(count);
+    for (int ii = 0; ii < count; ++ii) {
+        auto* inpObj = verifyInput(inputs[ii], err);
+        if (inpObj == nullptr) {
+            return;
+        }
+        inpPtrs.push_back(inpObj->inputPtr);
+    }
+    try {
+        fedObj->getValueBatch(inpPtrs, values, updated);
+    }
+    catch (...) {
+        helicsErrorHandler(err);
+    }
+}
+
 static constexpr char invalidPubName[] = "the specified publication name is a not a valid publication name";
 static constexpr char invalidPubIndex[] = "the specified publication index is not valid";
 
@@ -16,6 +16,7 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include <future>
 #include <gtest/gtest.h>
+#include <thread>
 /** these test cases test out the value converters
  */
 
@@ -167,6 +168,39 @@ TEST(federate_tests, federate_multiple_federates)
     Fed2->finalize();
 }
 
+TEST(federate_tests, federate_busy_poll)
+{
+    helics::FederateInfo fi(CORE_TYPE_TO_TEST);
+    fi.coreName = "core1-busy";
+    fi.coreInitString = "-f 2 --autobroker";
+    fi.loadInfoFromArgs("--flags=busy_poll");
+
+    auto Fed1 = std::make_shared<helics::Federate>("fed1", fi);
+    fi.setProperty(helics_property_int_busy_poll_budget, 200);
+    auto Fed2 = std::make_shared<helics::Federate>("fed2", fi);
+
+    EXPECT_TRUE(Fed1->getFlagOption(helics_flag_busy_poll));
+    EXPECT_EQ(Fed1->getIntegerProperty(helics_property_int_busy_poll_budget), 0);
+    EXPECT_EQ(Fed2->getIntegerProperty(helics_property_int_busy_poll_budget), 200);
+
+    auto f1finish = std::async(std::launch::async, [&]() { Fed1->enterExecutingMode(); });
+    Fed2->enterExecutingMode();
+    f1finish.wait();
+    for (int ii = 1; ii <= 10; ++ii) {
+        auto nextTime = static_cast<double>(ii);
+        auto f1step =
+            std::async(std::launch::async, [&]() { return Fed1->requestTime(nextTime); });
+        // give the budget of the second federate a chance to run out
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        EXPECT_EQ(Fed2->requestTime(nextTime), nextTime);
+        EXPECT_EQ(f1step.get(), nextTime);
+    }
+    Fed1->setFlagOption(helics_flag_busy_poll, false);
+    EXPECT_FALSE(Fed1->getFlagOption(helics_flag_busy_poll));
+    Fed1->finalize();
+    Fed2->finalize();
+}
+
 /** the same as the previous test except with multiple cores and a single broker*/
 TEST(federate_tests, multiple_federates_multi_cores)
 {
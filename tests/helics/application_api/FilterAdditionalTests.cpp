@@ -9,6 +9,7 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/application_api/Filters.hpp"
 #include "helics/application_api/MessageFederate.hpp"
 #include "helics/application_api/MessageOperators.hpp"
+#include "helics/core/ActionMessage.hpp"
 #include "testFixtures.hpp"
 
 #include <future>
@@ -594,4 +595,64 @@ TEST_P(filter_type_tests, test_filter_info_field_ci_skip)
     mFed->finalizeComplete();
 }
 
+TEST(filter_operations, in_place)
+{
+    helics::ActionMessage cmd(helics::CMD_SEND_MESSAGE);
+    cmd.actionTime = 1.0;
+    cmd.payload = "message data";
+    cmd.setStringData("dest", "src", "src", "");
+
+    helics::DelayFilterOperation delay(2.5);
+    auto op = delay.getOperator();
+    ASSERT_TRUE(op->isInPlace());
+    auto view = createMessageView(cmd);
+    EXPECT_TRUE(op->processInPlace(view));
+    EXPECT_EQ(cmd.actionTime, 3.5);
+
+    helics::RerouteFilterOperation reroute;
+    reroute.setString("newdestination", "rerouted");
+    op = reroute.getOperator();
+    ASSERT_TRUE(op->isInPlace());
+    EXPECT_TRUE(op->processInPlace(view));
+    EXPECT_EQ(cmd.getString(helics::targetStringLoc), "rerouted");
+    EXPECT_EQ(cmd.getString(helics::origDestStringLoc), "dest");
+    EXPECT_EQ(cmd.payload, "message data");
+
+    helics::RandomDropFilterOperation drop;
+    drop.set("prob", 1.0);
+    op = drop.getOperator();
+    ASSERT_TRUE(op->isInPlace());
+    EXPECT_FALSE(op->processInPlace(view));
+
+    helics::CloneFilterOperation clone;
+    clone.setString("add delivery", "copy1");
+    clone.setString("add delivery", "copy2");
+    op = clone.getOperator();
+    ASSERT_TRUE(op->isInPlace());
+    std::vector<std::string> destinations;
+    op->getCloneDestinations(view, destinations);
+    ASSERT_EQ(destinations.size(), 2U);
+    EXPECT_EQ(destinations[0], "copy1");
+    EXPECT_EQ(destinations[1], "copy2");
+    // the Message interface still generates the copies
+    auto copies = op->processVector(createMessageFromCommand(cmd));
+    ASSERT_EQ(copies.size(), 2U);
+    EXPECT_EQ(copies[1]->dest, "copy2");
+    EXPECT_EQ(copies[1]->original_dest, "rerouted");
+    EXPECT_EQ(copies[1]->data.to_string(), "message data");
+}
+
+TEST(filter_operations, message_function_precedence)
+{
+    auto op = std::make_shared<helics::MessageConditionalOperator>();
+    op->setViewConditionFunction([](const helics::MessageView& /*mess*/) { return false; });
+    EXPECT_TRUE(op->isInPlace());
+    op->setConditionFunction([](const helics::Message* /*mess*/) { return true; });
+    // a Message based function disables the in place processing
+    EXPECT_FALSE(op->isInPlace());
+    auto mess = std::make_unique<helics::Message>();
+    mess->dest = "dest";
+    EXPECT_TRUE((*op)(std::move(mess)));
+}
+
 INSTANTIATE_TEST_SUITE_P(filter_tests, filter_type_tests, ::testing::ValuesIn(core_types));
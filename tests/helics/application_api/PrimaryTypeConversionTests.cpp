@@ -84,7 +84,7 @@ TEST(type_conversion_tests, double_conversion_tests)
 {
     double val = 45.786;
     EXPECT_TRUE(checkTypeConversion1(val, val));
-    EXPECT_TRUE(checkTypeConversion1(val, std::to_string(val)));
+    EXPECT_TRUE(checkTypeConversion1(val, std::string("45.786")));
     EXPECT_TRUE(checkTypeConversion1(val, static_cast<int64_t>(val)));
     EXPECT_TRUE(checkTypeConversion1(val, static_cast<float>(val)));
     EXPECT_TRUE(checkTypeConversion1(val, std::complex<double>(val, 0)));
@@ -175,7 +175,7 @@ TEST(type_conversion_tests, namedpoint_conversion_tests)
     EXPECT_TRUE(checkTypeConversion1(
         vp, std::vector<std::complex<double>>{std::complex<double>(val, 0.0)}));
     EXPECT_TRUE(checkTypeConversion1(vp, true));
-    EXPECT_TRUE(checkTypeConversion1(vp, std::string("{\"point\":" + std::to_string(val) + "}")));
+    EXPECT_TRUE(checkTypeConversion1(vp, std::string("{\"point\":45.786}")));
 
     NamedPoint vp2{"v2[3.0,-4.0]", std::nan("0")};
     double v2 = 5.0;
@@ -224,3 +224,32 @@ TEST(type_conversion_tests, bool_conversion_tests)
     EXPECT_TRUE(checkTypeConversion1(std::complex<double>{0.0, 1.0}, val));
     EXPECT_TRUE(checkTypeConversion1(std::complex<double>{0.0, -0.5}, val));
 }
+
+TEST(type_conversion_tests, vector_change_detection)
+{
+    // sizes cover partial blocks and changes in both the blocks and the remainder
+    for (size_t size : {0, 5, 32, 100, 1000}) {
+        std::vector<double> prev(size);
+        for (size_t ii = 0; ii < size; ++ii) {
+            prev[ii] = static_cast<double>(ii) * 0.25;
+        }
+        auto vals = prev;
+        EXPECT_FALSE(vectorChangeDetected(prev.data(), vals.data(), size, 0.01));
+        EXPECT_EQ(vectorChangeDetected(prev.data(), vals.data(), size, -1.0), size > 0);
+        for (size_t ii = 0; ii < size; ++ii) {
+            vals[ii] += 0.005;
+        }
+        EXPECT_FALSE(vectorChangeDetected(prev.data(), vals.data(), size, 0.01));
+        if (size > 0) {
+            for (size_t index : {size_t(0), size / 2, size - 1}) {
+                auto changed = vals;
+                changed[index] -= 0.02;
+                EXPECT_TRUE(vectorChangeDetected(prev.data(), changed.data(), size, 0.01));
+            }
+        }
+    }
+    defV prevValue = std::vector<double>{1.0, 2.0, 3.0};
+    EXPECT_FALSE(changeDetected(prevValue, std::vector<double>{1.0, 2.0, 3.0}, 0.1));
+    EXPECT_TRUE(changeDetected(prevValue, std::vector<double>{1.0, 2.0, 3.5}, 0.1));
+    EXPECT_TRUE(changeDetected(prevValue, std::vector<double>{1.0, 2.0}, 0.1));
+}
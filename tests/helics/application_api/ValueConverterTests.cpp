@@ -211,3 +211,30 @@ TEST(valueConverter_tests, errors)
     EXPECT_LT(vb1.size(), 12u);
     EXPECT_GT(vb1.size(), 8u);
 }
+
+/** check that the direct encoding matches the archive encoding*/
+TEST(valueConverter_tests, direct)
+{
+    for (double val : {0.0, -3.1415, 1.7e300, -2.5e-310}) {
+        auto vb = helics::ValueConverter<double>::convert(val);
+        char buffer[helics::detail::doubleEncodingSize];
+        helics::detail::encodeDirect(val, buffer);
+        EXPECT_EQ(vb.to_string(), std::string(buffer, helics::detail::doubleEncodingSize));
+        double res{1.0};
+        EXPECT_TRUE(helics::detail::decodeDirect(vb, res));
+        EXPECT_EQ(res, val);
+    }
+    std::complex<double> cres;
+    EXPECT_TRUE(helics::detail::decodeDirect(
+        helics::ValueConverter<std::complex<double>>::convert({2.5, -1.0}), cres));
+    EXPECT_EQ(cres, std::complex<double>(2.5, -1.0));
+    std::vector<double> vres{7.0};
+    EXPECT_TRUE(helics::detail::decodeDirect(
+        helics::ValueConverter<std::vector<double>>::convert(std::vector<double>{1.0, 2.0}), vres));
+    EXPECT_EQ(vres, std::vector<double>({1.0, 2.0}));
+
+    double res{0.0};
+    EXPECT_FALSE(helics::detail::decodeDirect(helics::ValueConverter<int>::convert(10), res));
+    EXPECT_FALSE(helics::detail::decodeDirect(helics::data_view("3.1415926"), res));
+    EXPECT_FALSE(helics::detail::decodeDirect(helics::ValueConverter<double>::convert(1.0), vres));
+}
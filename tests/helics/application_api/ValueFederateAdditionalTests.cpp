@@ -759,6 +759,109 @@ TEST(valuefed_json_tests, test_json_register_publish_error)
     vFed.disconnect();
 }
 
+TEST_P(valuefed_add_type_tests_ci_skip, publish_batch)
+{
+    SetupTest<helics::ValueFederate>(GetParam(), 2);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+    auto vFed2 = GetFederateAs<helics::ValueFederate>(1);
+
+    auto& p1 = vFed1->registerGlobalPublication<double>("pub1");
+    auto& p2 = vFed1->registerGlobalPublication<std::string>("pub2");
+    auto& p3 = vFed1->registerGlobalPublication<double>("pub3");
+    p3.setMinimumChange(1.0);
+    // pub1 has two subscribers so it goes to the second federate twice
+    auto& s1 = vFed2->registerSubscription("pub1");
+    auto& s1b = vFed2->registerSubscription("pub1");
+    auto& s2 = vFed2->registerSubscription("pub2");
+    auto& s3 = vFed2->registerSubscription("pub3");
+
+    vFed1->enterExecutingModeAsync();
+    vFed2->enterExecutingMode();
+    vFed1->enterExecutingModeComplete();
+
+    std::vector<helics::Publication*> pubs{&p1, &p2, &p3};
+    vFed1->publishBatch(pubs, {1.5, 2.5, 3.5});
+    vFed1->requestTimeAsync(1.0);
+    vFed2->requestTime(1.0);
+    vFed1->requestTimeComplete();
+    EXPECT_DOUBLE_EQ(s1.getValue<double>(), 1.5);
+    EXPECT_DOUBLE_EQ(s1b.getValue<double>(), 1.5);
+    EXPECT_DOUBLE_EQ(s2.getValue<double>(), 2.5);
+    EXPECT_DOUBLE_EQ(s3.getValue<double>(), 3.5);
+
+    // the change on pub3 is below the minimum so it is not published
+    vFed1->publishBatch(pubs, {4.5, 5.5, 3.7});
+    vFed1->requestTimeAsync(2.0);
+    vFed2->requestTime(2.0);
+    vFed1->requestTimeComplete();
+    EXPECT_DOUBLE_EQ(s1.getValue<double>(), 4.5);
+    EXPECT_DOUBLE_EQ(s2.getValue<double>(), 5.5);
+    EXPECT_FALSE(s3.isUpdated());
+    EXPECT_DOUBLE_EQ(s3.getValue<double>(), 3.5);
+
+    EXPECT_THROW(vFed1->publishBatch(pubs, {1.0}), helics::InvalidParameter);
+    vFed1->finalize();
+    vFed2->finalize();
+}
+
+TEST_P(valuefed_add_type_tests_ci_skip, get_value_batch)
+{
+    SetupTest<helics::ValueFederate>(GetParam(), 1);
+    auto vFed1 = GetFederateAs<helics::ValueFederate>(0);
+
+    auto& p1 = vFed1->registerGlobalPublication<double>("pub1");
+    auto& p2 = vFed1->registerGlobalPublication<std::string>("pub2");
+    auto& p3 = vFed1->registerGlobalPublication<double>("pub3");
+    auto& p4 = vFed1->registerGlobalPublication<std::complex<double>>("pub4");
+    auto& p5 = vFed1->registerGlobalPublication<std::vector<double>>("pub5");
+    auto& s1 = vFed1->registerSubscription("pub1");
+    auto& s2 = vFed1->registerSubscription("pub2");
+    auto& s3 = vFed1->registerSubscription("pub3");
+    s3.setMinimumChange(1.0);
+    auto& s4 = vFed1->registerSubscription("pub4");
+    auto& s5 = vFed1->registerSubscription("pub5");
+    vFed1->enterExecutingMode();
+
+    p1.publish(1.5);
+    p2.publish("2.5");
+    p3.publish(3.5);
+    p4.publish(std::complex<double>(1.0, -2.0));
+    p5.publish(std::vector<double>{1.0, 2.0, 3.0});
+    vFed1->requestTime(1.0);
+
+    std::vector<helics::Input*> inputs{&s1, &s2, &s3};
+    double vals[3];
+    std::uint64_t updated{0};
+    vFed1->getValueBatch(inputs, vals, &updated);
+    EXPECT_DOUBLE_EQ(vals[0], 1.5);
+    EXPECT_DOUBLE_EQ(vals[1], 2.5);
+    EXPECT_DOUBLE_EQ(vals[2], 3.5);
+    EXPECT_EQ(updated, 7U);
+    EXPECT_FALSE(s1.isUpdated());
+
+    std::complex<double> cval;
+    vFed1->getValueBatch({&s4}, &cval, &updated);
+    EXPECT_EQ(cval, std::complex<double>(1.0, -2.0));
+    EXPECT_EQ(updated, 1U);
+    std::vector<double> vval;
+    vFed1->getValueBatch({&s5}, &vval, &updated);
+    EXPECT_EQ(vval, std::vector<double>({1.0, 2.0, 3.0}));
+
+    // only pub1 changes and the change on pub3 is below the minimum
+    p1.publish(4.5);
+    p3.publish(3.7);
+    vFed1->requestTime(2.0);
+    vFed1->getValueBatch(inputs, vals, &updated);
+    EXPECT_DOUBLE_EQ(vals[0], 4.5);
+    EXPECT_DOUBLE_EQ(vals[1], 2.5);
+    EXPECT_DOUBLE_EQ(vals[2], 3.5);
+    EXPECT_EQ(updated, 1U);
+
+    vFed1->getValueBatch(inputs, vals);
+    EXPECT_DOUBLE_EQ(vals[0], 4.5);
+    vFed1->finalize();
+}
+
 INSTANTIATE_TEST_SUITE_P(
     valuefed_tests,
     valuefed_add_single_type_tests_ci_skip,
@@ -1078,3 +1181,72 @@ TEST(valuefederate, indexed_targets)
 
     Fed1->finalize();
 }
+
+TEST(valuefederate, batch_processing)
+{
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "core_batch";
+    fi.coreInitString = "-f 2 --autobroker --batch_processing";
+
+    auto Fed1 = std::make_shared<helics::ValueFederate>("vfed1", fi);
+    auto Fed2 = std::make_shared<helics::ValueFederate>("vfed2", fi);
+    auto& p1 = Fed1->registerGlobalPublication<double>("pub1");
+    auto& s1 = Fed2->registerSubscription("pub1");
+    auto& p2 = Fed2->registerGlobalPublication<double>("pub2");
+    auto& s2 = Fed1->registerSubscription("pub2");
+
+    Fed1->enterExecutingModeAsync();
+    Fed2->enterExecutingMode();
+    Fed1->enterExecutingModeComplete();
+    for (int ii = 1; ii <= 10; ++ii) {
+        p1.publish(static_cast<double>(ii));
+        p2.publish(static_cast<double>(ii) * 2.0);
+        Fed1->requestTimeAsync(ii);
+        auto gtime = Fed2->requestTime(ii);
+        EXPECT_EQ(gtime, static_cast<double>(ii));
+        EXPECT_EQ(Fed1->requestTimeComplete(), gtime);
+        EXPECT_DOUBLE_EQ(s1.getValue<double>(), static_cast<double>(ii));
+        EXPECT_DOUBLE_EQ(s2.getValue<double>(), static_cast<double>(ii) * 2.0);
+    }
+    Fed1->finalize();
+    Fed2->finalize();
+}
+
+TEST(valuefederate, sharded_core)
+{
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "core_shards";
+    fi.coreInitString = "-f 3 --autobroker --shards=2";
+
+    auto Fed1 = std::make_shared<helics::ValueFederate>("vfed1", fi);
+    auto Fed2 = std::make_shared<helics::ValueFederate>("vfed2", fi);
+    auto Fed3 = std::make_shared<helics::ValueFederate>("vfed3", fi);
+    // pub1 has two subscribers so its values are sent as a packed message
+    auto& p1 = Fed1->registerGlobalPublication<double>("pub1");
+    auto& s1 = Fed2->registerSubscription("pub1");
+    auto& s3 = Fed3->registerSubscription("pub1");
+    auto& p2 = Fed2->registerGlobalPublication<double>("pub2");
+    auto& s2 = Fed1->registerSubscription("pub2");
+
+    Fed1->enterExecutingModeAsync();
+    Fed3->enterExecutingModeAsync();
+    Fed2->enterExecutingMode();
+    Fed1->enterExecutingModeComplete();
+    Fed3->enterExecutingModeComplete();
+    for (int ii = 1; ii <= 20; ++ii) {
+        p1.publish(static_cast<double>(ii));
+        p2.publish(static_cast<double>(ii) * 2.0);
+        Fed1->requestTimeAsync(ii);
+        Fed3->requestTimeAsync(ii);
+        auto gtime = Fed2->requestTime(ii);
+        EXPECT_EQ(gtime, static_cast<double>(ii));
+        EXPECT_EQ(Fed1->requestTimeComplete(), gtime);
+        EXPECT_EQ(Fed3->requestTimeComplete(), gtime);
+        EXPECT_DOUBLE_EQ(s1.getValue<double>(), static_cast<double>(ii));
+        EXPECT_DOUBLE_EQ(s3.getValue<double>(), static_cast<double>(ii));
+        EXPECT_DOUBLE_EQ(s2.getValue<double>(), static_cast<double>(ii) * 2.0);
+    }
+    Fed1->finalize();
+    Fed2->finalize();
+    Fed3->finalize();
+}
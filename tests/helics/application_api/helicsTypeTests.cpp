@@ -89,3 +89,31 @@ TEST(helics_types, cvector_string)
     ASSERT_EQ(v.size(), 3U);
     EXPECT_EQ(v[2], invalidValue<std::complex<double>>());
 }
+
+TEST(helics_types, double_string_shortest)
+{
+    EXPECT_EQ(helicsDoubleString(3.1), "3.1");
+    EXPECT_EQ(helicsDoubleString(-4.79), "-4.79");
+    EXPECT_EQ(helicsVectorString(std::vector<double>{4.79, -2.5}), "v2[4.79; -2.5]");
+    EXPECT_EQ(helicsComplexString(1.5, -2.25), "1.5 -2.25j");
+    EXPECT_EQ(helicsNamedPointString("pt", 0.1), "{\"pt\":0.1}");
+
+    const std::vector<double> vals{0.1, 1.0 / 3.0, -2.2250738585072014e-308, 6.02214076e23, 1e-5};
+    for (auto val : vals) {
+        EXPECT_EQ(getDoubleFromString(helicsDoubleString(val)), std::abs(val));
+        EXPECT_EQ(helicsGetComplex(helicsDoubleString(val)).real(), val);
+    }
+    EXPECT_EQ(helicsGetVector(helicsVectorString(vals)), vals);
+}
+
+TEST(helics_types, complex_string_exponent)
+{
+    auto v = helicsGetComplex("1.5e3-2.5e-2j");
+    EXPECT_EQ(v, std::complex<double>(1500.0, -0.025));
+    v = helicsGetComplex("-1.25 + 3e2i");
+    EXPECT_EQ(v, std::complex<double>(-1.25, 300.0));
+    v = helicsGetComplex("2.5e1j");
+    EXPECT_EQ(v, std::complex<double>(0.0, 25.0));
+    v = helicsGetComplex(helicsComplexString(1.0 / 3.0, -1e-30));
+    EXPECT_EQ(v, std::complex<double>(1.0 / 3.0, -1e-30));
+}
@@ -23,7 +23,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/apps/Recorder.hpp"
 
 #include <cstdio>
+#include <fstream>
 #include <future>
+#include <string>
 
 TEST(recorder_tests, simple_recorder_test)
 {
@@ -83,11 +85,11 @@ TEST(recorder_tests, simple_recorder_test2)
     rec1.finalize();
     auto v1 = rec1.getValue(0);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(3.4));
+    EXPECT_EQ(v1.second, "3.4");
 
     v1 = rec1.getValue(1);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(4.7));
+    EXPECT_EQ(v1.second, "4.7");
 
     v1 = rec1.getValue(2);
     EXPECT_EQ(v1.first, std::string());
@@ -170,18 +172,18 @@ TEST_P(recorder_file_tests, test_files)
     EXPECT_EQ(rec1.pointCount(), 4u);
     auto v1 = rec1.getValue(0);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(3.4));
+    EXPECT_EQ(v1.second, "3.4");
     v1 = rec1.getValue(1);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(5.7));
+    EXPECT_EQ(v1.second, "5.7");
 
     v1 = rec1.getValue(2);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(4.7));
+    EXPECT_EQ(v1.second, "4.7");
 
     v1 = rec1.getValue(3);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(3.9));
+    EXPECT_EQ(v1.second, "3.9");
 }
 
 static constexpr const char* simple_files[] = {"example1.recorder",
@@ -245,18 +247,18 @@ TEST_P(recorder_message_file_tests, test_message_files)
 
     auto v1 = rec1.getValue(0);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(3.4));
+    EXPECT_EQ(v1.second, "3.4");
     v1 = rec1.getValue(1);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(5.7));
+    EXPECT_EQ(v1.second, "5.7");
 
     v1 = rec1.getValue(2);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(4.7));
+    EXPECT_EQ(v1.second, "4.7");
 
     v1 = rec1.getValue(3);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(3.9));
+    EXPECT_EQ(v1.second, "3.9");
 
     auto m = rec1.getMessage(1);
     ASSERT_TRUE(m);
@@ -321,18 +323,18 @@ TEST_P(recorder_message_file_tests, test_message_files_cmd)
 
     auto v1 = rec1.getValue(0);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(3.4));
+    EXPECT_EQ(v1.second, "3.4");
     v1 = rec1.getValue(1);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(5.7));
+    EXPECT_EQ(v1.second, "5.7");
 
     v1 = rec1.getValue(2);
     EXPECT_EQ(v1.first, "pub1");
-    EXPECT_EQ(v1.second, std::to_string(4.7));
+    EXPECT_EQ(v1.second, "4.7");
 
     v1 = rec1.getValue(3);
     EXPECT_EQ(v1.first, "pub2");
-    EXPECT_EQ(v1.second, std::to_string(3.9));
+    EXPECT_EQ(v1.second, "3.9");
 
     auto m = rec1.getMessage(1);
     ASSERT_TRUE(m);
@@ -602,6 +604,78 @@ TEST(recorder_tests, recorder_test_saveFile1)
     ghc::filesystem::remove(filename2);
 }
 
+TEST(recorder_tests, recorder_test_streaming)
+{
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "rcore-stream";
+    fi.coreInitString = "-f 2 --autobroker";
+    auto filename = ghc::filesystem::temp_directory_path() / "streamfile.txt";
+    {
+        helics::apps::Recorder rec1("rec1", fi);
+        rec1.addSubscription("pub1");
+        rec1.setStreaming(filename.string(), 1);
+
+        helics::ValueFederate vfed("block1", fi);
+        helics::Publication pub1(helics::GLOBAL, &vfed, "pub1", helics::data_type::helics_double);
+        auto fut = std::async(std::launch::async, [&rec1]() { rec1.runTo(4); });
+        vfed.enterExecutingMode();
+        auto retTime = vfed.requestTime(1);
+        EXPECT_EQ(retTime, 1.0);
+        pub1.publish(3.4);
+
+        retTime = vfed.requestTime(2.0);
+        EXPECT_EQ(retTime, 2.0);
+        pub1.publish(4.7);
+
+        retTime = vfed.requestTime(5);
+        EXPECT_EQ(retTime, 5.0);
+
+        vfed.finalize();
+        fut.get();
+        // the points are written as they are captured so nothing is held by the recorder
+        EXPECT_EQ(rec1.pointCount(), 2u);
+        EXPECT_THROW(rec1.getValue(0), helics::InvalidParameter);
+
+        std::ifstream infile(filename.string());
+        std::string line;
+        int dataLines{0};
+        while (std::getline(infile, line)) {
+            if (!line.empty() && line.front() != '#') {
+                ++dataLines;
+                EXPECT_NE(line.find("pub1"), std::string::npos);
+            }
+        }
+        EXPECT_EQ(dataLines, 2);
+        rec1.finalize();
+
+        auto copyname = ghc::filesystem::temp_directory_path() / "streamcopy.txt";
+        rec1.saveFile(copyname.string());
+        std::ifstream copyfile(copyname.string());
+        dataLines = 0;
+        while (std::getline(copyfile, line)) {
+            if (!line.empty() && line.front() != '#') {
+                ++dataLines;
+            }
+        }
+        EXPECT_EQ(dataLines, 2);
+        copyfile.close();
+        ghc::filesystem::remove(copyname);
+        EXPECT_THROW(rec1.saveFile("streamcopy.json"), helics::InvalidParameter);
+    }
+    EXPECT_TRUE(ghc::filesystem::exists(filename));
+    ghc::filesystem::remove(filename);
+}
+
+TEST(recorder_tests, recorder_test_streaming_json)
+{
+    helics::FederateInfo fi(helics::core_type::TEST);
+    fi.coreName = "rcore-stream-json";
+    fi.coreInitString = "-f 1 --autobroker";
+    helics::apps::Recorder rec1("rec1", fi);
+    EXPECT_THROW(rec1.setStreaming("streamfile.json"), helics::InvalidParameter);
+    rec1.finalize();
+}
+
 TEST(recorder_tests, recorder_test_saveFile2)
 {
     helics::FederateInfo fi(helics::core_type::TEST);
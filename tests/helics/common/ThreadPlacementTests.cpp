@@ -0,0 +1,60 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/common/ThreadPlacement.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace helics;
+
+TEST(thread_placement_tests, parse_lists)
+{
+    auto placement = parseThreadPlacement("0-3,8");
+    EXPECT_EQ(placement.cpus, std::vector<int>({0, 1, 2, 3, 8}));
+    EXPECT_EQ(placement.numaNode, -1);
+
+    placement = parseThreadPlacement(" 5, 2 ,2-3");
+    EXPECT_EQ(placement.cpus, std::vector<int>({2, 3, 5}));
+
+    placement = parseThreadPlacement("node:1");
+    EXPECT_TRUE(placement.cpus.empty());
+    EXPECT_EQ(placement.numaNode, 1);
+    EXPECT_FALSE(placement.empty());
+
+    EXPECT_TRUE(parseThreadPlacement("").empty());
+}
+
+TEST(thread_placement_tests, parse_errors)
+{
+    EXPECT_THROW(parseThreadPlacement("a"), std::invalid_argument);
+    EXPECT_THROW(parseThreadPlacement("3-1"), std::invalid_argument);
+    EXPECT_THROW(parseThreadPlacement("1-"), std::invalid_argument);
+    EXPECT_THROW(parseThreadPlacement("99999"), std::invalid_argument);
+    EXPECT_THROW(parseThreadPlacement("node:x"), std::invalid_argument);
+    EXPECT_THROW(parseThreadPlacement(","), std::invalid_argument);
+}
+
+TEST(thread_placement_tests, place_thread)
+{
+    ThreadPlacementInfo info;
+    std::thread thr([&info] {
+        info = placeCurrentThread("test", "placement_test", parseThreadPlacement("0"));
+    });
+    thr.join();
+    EXPECT_EQ(info.role, "test");
+    EXPECT_EQ(info.name, "placement_test");
+#ifdef __linux__
+    EXPECT_TRUE(info.applied);
+    EXPECT_EQ(info.cpus, std::vector<int>({0}));
+    EXPECT_EQ(info.cpu, 0);
+#endif
+    auto json = generateThreadPlacementJson("obj", {info});
+    EXPECT_NE(json.find("\"placement_test\""), std::string::npos);
+}
@@ -406,3 +406,243 @@ TEST(ActionMessage_tests, check_packetization)
     EXPECT_EQ(cmd.flags, cmd2.flags);
     EXPECT_TRUE(cmd.getStringData() == cmd2.getStringData());
 }
+
+TEST(ActionMessage_tests, string_data_handling)
+{
+    helics::ActionMessage cmd(helics::CMD_MULTI_MESSAGE);
+    cmd.sequenceID = 27;
+    for (int ii = 0; ii < 10; ++ii) {
+        cmd.setString(ii, std::string("string number ") + std::to_string(ii));
+    }
+    EXPECT_EQ(cmd.getStringData().size(), 10U);
+    EXPECT_EQ(cmd.getString(3), "string number 3");
+    EXPECT_EQ(cmd.getString(9), "string number 9");
+
+    auto cmdString = cmd.to_string();
+    helics::ActionMessage cmd2(cmdString);
+    EXPECT_TRUE(cmd.getStringData() == cmd2.getStringData());
+    EXPECT_EQ(cmd2.sequenceID, 27U);
+
+    helics::ActionMessage cmd3(std::move(cmd2));
+    EXPECT_EQ(cmd3.getString(7), "string number 7");
+    EXPECT_EQ(cmd3.sequenceID, 27U);
+
+    cmd3.setStringData("target", "source");
+    EXPECT_EQ(cmd3.getStringData().size(), 2U);
+    EXPECT_EQ(cmd3.getString(0), "target");
+    EXPECT_TRUE(cmd3.getString(5).empty());
+    cmd3.clearStringData();
+    EXPECT_TRUE(cmd3.getStringData().empty());
+}
+
+TEST(ActionMessage_tests, pack_messages)
+{
+    std::vector<helics::ActionMessage> regs;
+    for (int ii = 0; ii < 600; ++ii) {
+        helics::ActionMessage reg(helics::CMD_REG_PUB);
+        reg.source_handle = helics::interface_handle(ii);
+        reg.name = "publication_" + std::to_string(ii);
+        reg.setStringData("double", "kW");
+        regs.push_back(reg);
+    }
+    // a large size limit is bounded by the 255 message limit of each container
+    auto packages = helics::packMessages(regs, helics::CMD_MULTI_REGISTRATION, 1000000);
+    ASSERT_EQ(packages.size(), 3U);
+    EXPECT_EQ(packages[0].counter, 255);
+    EXPECT_EQ(packages[2].counter, 90);
+    EXPECT_TRUE(packages[1].action() == helics::CMD_MULTI_REGISTRATION);
+
+    int index = 0;
+    for (auto& package : packages) {
+        helics::ActionMessage transmitted(package.to_string());
+        for (int ii = 0; ii < transmitted.counter; ++ii) {
+            helics::ActionMessage reg(transmitted.getString(ii));
+            EXPECT_TRUE(reg.action() == helics::CMD_REG_PUB);
+            EXPECT_EQ(reg.source_handle, helics::interface_handle(index));
+            EXPECT_EQ(reg.name, "publication_" + std::to_string(index));
+            EXPECT_EQ(reg.getString(unitStringLoc), "kW");
+            ++index;
+        }
+    }
+    EXPECT_EQ(index, 600);
+
+    // a small size limit splits the messages into more containers
+    auto smallPackages = helics::packMessages(regs, helics::CMD_MULTI_REGISTRATION, 1024);
+    EXPECT_GT(smallPackages.size(), packages.size());
+    for (auto& package : smallPackages) {
+        std::size_t packedSize{0};
+        for (const auto& str : package.getStringData()) {
+            packedSize += str.size();
+        }
+        EXPECT_LE(packedSize, 1024U);
+    }
+}
+
+TEST(ActionMessage_tests, shared_payload)
+{
+    helics::ActionMessage cmd(helics::CMD_PUB);
+    cmd.source_id = helics::global_federate_id(2'000'000'000);
+    cmd.dest_handle = helics::interface_handle(4);
+    cmd.actionTime = 45.7;
+    std::string value(2000, 'a');
+    auto data = std::make_shared<const helics::data_block>(value);
+    cmd.setSharedPayload(data);
+    EXPECT_EQ(cmd.payloadSize(), 2000U);
+    EXPECT_TRUE(cmd.payload.empty());
+
+    helics::ActionMessage cmd2(cmd);
+    EXPECT_EQ(cmd2.getSharedPayload().get(), data.get());
+    helics::ActionMessage cmd3(std::move(cmd2));
+    EXPECT_EQ(cmd3.getSharedPayload().get(), data.get());
+
+    // serialization writes the shared data as the payload
+    auto cmdString = cmd3.packetize();
+    helics::ActionMessage cmd4;
+    cmd4.depacketize(cmdString.data(), static_cast<int>(cmdString.size()));
+    EXPECT_FALSE(cmd4.getSharedPayload());
+    EXPECT_EQ(cmd4.payload, value);
+    EXPECT_EQ(cmd4.actionTime, cmd.actionTime);
+    EXPECT_EQ(cmd4.source_id, cmd.source_id);
+}
+
+TEST(ActionMessage_tests, shared_payload_package)
+{
+    std::string value(2000, 'b');
+    auto data = std::make_shared<const helics::data_block>(value);
+    helics::ActionMessage package(helics::CMD_MULTI_MESSAGE);
+    package.setSharedPayload(data);
+
+    helics::ActionMessage cmd(helics::CMD_PUB);
+    cmd.source_id = helics::global_federate_id(2'000'000'000);
+    cmd.actionTime = 45.7;
+    for (int ii = 0; ii < 3; ++ii) {
+        cmd.dest_handle = helics::interface_handle(ii);
+        appendMessage(package, cmd);
+    }
+    EXPECT_EQ(package.counter, 3);
+
+    for (int ii = 0; ii < 3; ++ii) {
+        auto msg = unpackMessage(package, ii);
+        EXPECT_EQ(msg.action(), helics::CMD_PUB);
+        EXPECT_EQ(msg.dest_handle, helics::interface_handle(ii));
+        EXPECT_EQ(msg.getSharedPayload().get(), data.get());
+    }
+
+    // a serialized package carries the value once and the messages still share it
+    helics::ActionMessage package2(package.to_string());
+    EXPECT_FALSE(package2.getSharedPayload());
+    EXPECT_EQ(package2.payload, value);
+    auto msg1 = unpackMessage(package2, 0);
+    auto msg2 = unpackMessage(package2, 2);
+    ASSERT_TRUE(msg1.getSharedPayload());
+    EXPECT_EQ(msg1.getSharedPayload().get(), msg2.getSharedPayload().get());
+    EXPECT_EQ(msg2.getSharedPayload()->to_string(), value);
+    EXPECT_EQ(msg2.dest_handle, helics::interface_handle(2));
+}
+
+TEST(ActionMessage_tests, compact_encoding)
+{
+    helics::ActionMessage cmd(helics::CMD_TIME_REQUEST);
+    cmd.source_id = global_federate_id(131074);
+    cmd.dest_id = global_federate_id(1879048194);
+    cmd.actionTime = 45.7;
+    cmd.Te = cmd.actionTime;
+    cmd.Tdemin = 46.0;
+    cmd.Tso = Time::maxVal();
+    setActionFlag(cmd, iteration_requested_flag);
+
+    auto compact = cmd.to_compact_string();
+    EXPECT_LT(compact.size(), cmd.to_string().size() / 2);
+    helics::ActionMessage cmd2(compact);
+    EXPECT_TRUE(cmd.action() == cmd2.action());
+    EXPECT_EQ(cmd.source_id, cmd2.source_id);
+    EXPECT_EQ(cmd.dest_id, cmd2.dest_id);
+    EXPECT_EQ(cmd.source_handle, cmd2.source_handle);
+    EXPECT_EQ(cmd.dest_handle, cmd2.dest_handle);
+    EXPECT_EQ(cmd.actionTime, cmd2.actionTime);
+    EXPECT_EQ(cmd.Te, cmd2.Te);
+    EXPECT_EQ(cmd.Tdemin, cmd2.Tdemin);
+    EXPECT_EQ(cmd.Tso, cmd2.Tso);
+    EXPECT_EQ(cmd.flags, cmd2.flags);
+
+    helics::ActionMessage msg(helics::CMD_SEND_MESSAGE);
+    msg.source_id = global_federate_id(1);
+    msg.source_handle = interface_handle(2);
+    msg.dest_handle = interface_handle(4);
+    msg.messageID = -25;
+    msg.counter = 5;
+    msg.sequenceID = 1000;
+    msg.actionTime = Time::maxVal();
+    msg.payload = "hello world";
+    msg.setStringData("target", "source", "original_source");
+
+    auto packet = msg.packetize_compact();
+    helics::ActionMessage msg2;
+    auto res = msg2.depacketize(packet.data(), static_cast<int>(packet.size()));
+    EXPECT_EQ(res, static_cast<int>(packet.size()));
+    EXPECT_TRUE(msg.action() == msg2.action());
+    EXPECT_EQ(msg.source_id, msg2.source_id);
+    EXPECT_EQ(msg.dest_id, msg2.dest_id);
+    EXPECT_EQ(msg.source_handle, msg2.source_handle);
+    EXPECT_EQ(msg.dest_handle, msg2.dest_handle);
+    EXPECT_EQ(msg.messageID, msg2.messageID);
+    EXPECT_EQ(msg.counter, msg2.counter);
+    EXPECT_EQ(msg.sequenceID, msg2.sequenceID);
+    EXPECT_EQ(msg.actionTime, msg2.actionTime);
+    EXPECT_EQ(msg.payload, msg2.payload);
+    EXPECT_TRUE(msg.getStringData() == msg2.getStringData());
+
+    // truncated data is rejected
+    helics::ActionMessage msg3;
+    msg3.fromByteArray(packet.data() + 4, static_cast<int>(packet.size()) - 12);
+    EXPECT_TRUE(msg3.action() == CMD_INVALID);
+
+    // a short packet with the large header is recognized as well
+    helics::ActionMessage pub(helics::CMD_PUB);
+    pub.dest_handle = interface_handle(3);
+    pub.payload = "a";
+    packet = pub.packetize_compact();
+    std::string largePacket(1, '\xF4');
+    auto psize = static_cast<uint32_t>(packet.size() + 1 - 2);
+    largePacket.push_back(static_cast<char>((psize >> 24U) & 0xFFU));
+    largePacket.push_back(static_cast<char>((psize >> 16U) & 0xFFU));
+    largePacket.push_back(static_cast<char>((psize >> 8U) & 0xFFU));
+    largePacket.push_back(static_cast<char>(psize & 0xFFU));
+    largePacket.append(packet, 4, std::string::npos);
+    ASSERT_LT(largePacket.size(), 45U);
+    helics::ActionMessage msg4;
+    res = msg4.fromByteArray(largePacket.data(), static_cast<int>(largePacket.size()));
+    EXPECT_EQ(res, static_cast<int>(largePacket.size()));
+    EXPECT_TRUE(msg4.action() == CMD_PUB);
+    EXPECT_EQ(msg4.dest_handle, pub.dest_handle);
+    EXPECT_EQ(msg4.payload, pub.payload);
+
+    helics::ActionMessage msg5(helics::CMD_PUB);
+    res = msg5.fromByteArray(largePacket.data(), static_cast<int>(largePacket.size()) - 3);
+    EXPECT_EQ(res, 0);
+    EXPECT_TRUE(msg5.action() == CMD_INVALID);
+}
+
+TEST(ActionMessage_tests, large_payload)
+{
+    helics::ActionMessage cmd(helics::CMD_PUB);
+    cmd.source_id = global_federate_id(131074);
+    cmd.dest_handle = interface_handle(4);
+    cmd.actionTime = 2.0;
+    cmd.payload.assign(17 * 1024 * 1024, 'b');
+    cmd.payload[5000] = 'c';
+    EXPECT_TRUE(cmd.requiresCompactEncoding());
+
+    auto data = cmd.to_string();
+    helics::ActionMessage cmd2(data);
+    EXPECT_TRUE(cmd2.action() == CMD_PUB);
+    EXPECT_EQ(cmd2.payload, cmd.payload);
+
+    auto packet = cmd.packetize();
+    helics::ActionMessage cmd3;
+    auto res = cmd3.depacketize(packet.data(), static_cast<int>(packet.size()));
+    EXPECT_EQ(res, static_cast<int>(packet.size()));
+    EXPECT_EQ(cmd3.payload, cmd.payload);
+    EXPECT_EQ(cmd3.actionTime, cmd.actionTime);
+    EXPECT_EQ(cmd3.dest_handle, cmd.dest_handle);
+}
@@ -0,0 +1,175 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gtest/gtest.h"
+
+/** these test cases test the ActionMessageQueue and the lock free queue it can use
+ */
+
+#include "helics/core/ActionMessageQueue.hpp"
+#include "helics/core/MpscPriorityQueue.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace helics;
+
+TEST(mpsc_queue_tests, basic_order)
+{
+    MpscPriorityQueue<int> queue;
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.try_pop());
+    for (int ii = 0; ii < 10; ++ii) {
+        queue.push(ii);
+    }
+    queue.pushPriority(45);
+    queue.emplacePriority(46);
+    EXPECT_FALSE(queue.empty());
+    EXPECT_EQ(queue.pop(), 45);
+    EXPECT_EQ(queue.pop(), 46);
+    for (int ii = 0; ii < 10; ++ii) {
+        auto val = queue.try_pop();
+        ASSERT_TRUE(val);
+        EXPECT_EQ(*val, ii);
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(mpsc_queue_tests, multi_producer)
+{
+    MpscPriorityQueue<std::pair<int, int>> queue;
+    constexpr int producerCount{8};
+    constexpr int messageCount{20000};
+    std::vector<std::thread> producers;
+    for (int ii = 0; ii < producerCount; ++ii) {
+        producers.emplace_back([&queue, ii]() {
+            for (int jj = 0; jj < messageCount; ++jj) {
+                queue.emplace(ii, jj);
+            }
+        });
+    }
+    // the values from each producer should come out in the order they went in
+    std::vector<int> lastValue(producerCount, -1);
+    for (int kk = 0; kk < producerCount * messageCount; ++kk) {
+        auto val = queue.pop();
+        EXPECT_EQ(val.second, lastValue[val.first] + 1);
+        lastValue[val.first] = val.second;
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.empty());
+    for (auto& val : lastValue) {
+        EXPECT_EQ(val, messageCount - 1);
+    }
+}
+
+TEST(mpsc_queue_tests, blocking_pop)
+{
+    MpscPriorityQueue<int> queue;
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        queue.push(7);
+    });
+    EXPECT_EQ(queue.pop(), 7);
+    producer.join();
+}
+
+TEST(mpsc_queue_tests, push_vector)
+{
+    MpscPriorityQueue<int> queue;
+    queue.push(1);
+    queue.pushVector(std::vector<int>{2, 3, 4, 5});
+    queue.pushVector(std::vector<int>{});
+    queue.push(6);
+    for (int ii = 1; ii <= 6; ++ii) {
+        EXPECT_EQ(queue.pop(), ii);
+    }
+    EXPECT_TRUE(queue.empty());
+
+    queue.pushVector(std::vector<int>{7, 8, 9});
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.try_pop());
+}
+
+TEST(mpsc_queue_tests, ping_pong)
+{
+    // repeated handoffs exercise both the spinning and parking paths of the consumer
+    MpscPriorityQueue<int> request;
+    MpscPriorityQueue<int> response;
+    constexpr int exchangeCount{5000};
+    std::thread responder([&request, &response]() {
+        for (int ii = 0; ii < exchangeCount; ++ii) {
+            response.push(request.pop() + 1);
+        }
+    });
+    for (int ii = 0; ii < exchangeCount; ++ii) {
+        request.push(ii);
+        ASSERT_EQ(response.pop(), ii + 1);
+        if (ii % 1000 == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+    responder.join();
+}
+
+TEST(action_queue_tests, queue_types)
+{
+    ActionMessageQueue queue;
+    EXPECT_EQ(queue.getQueueType(), ActionMessageQueue::queue_type::blocking);
+    queue.push(CMD_TIME_REQUEST);
+    ActionMessage ign(CMD_IGNORE);
+    queue.push(ign);
+    queue.pushPriority(CMD_REG_FED);
+
+    // switching types keeps any pending messages
+    queue.setQueueType(ActionMessageQueue::queue_type::lockfree);
+    EXPECT_EQ(queue.getQueueType(), ActionMessageQueue::queue_type::lockfree);
+    EXPECT_FALSE(queue.empty());
+    queue.pushPriority(CMD_PRIORITY_ACK);
+    EXPECT_EQ(queue.pop().action(), CMD_REG_FED);
+    EXPECT_EQ(queue.pop().action(), CMD_PRIORITY_ACK);
+    EXPECT_EQ(queue.pop().action(), CMD_TIME_REQUEST);
+    queue.push(CMD_TICK);
+    queue.setQueueType(ActionMessageQueue::queue_type::blocking);
+    EXPECT_EQ(queue.pop().action(), CMD_IGNORE);
+    auto msg = queue.try_pop();
+    ASSERT_TRUE(msg);
+    EXPECT_EQ(msg->action(), CMD_TICK);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(action_queue_tests, switch_type_with_producers)
+{
+    // the configuring thread switches the type while producers are already pushing
+    ActionMessageQueue queue;
+    constexpr int producerCount{3};
+    constexpr int messageCount{20000};
+    std::vector<std::thread> producers;
+    for (int ii = 0; ii < producerCount; ++ii) {
+        producers.emplace_back([&queue, ii]() {
+            for (int jj = 0; jj < messageCount; ++jj) {
+                ActionMessage cmd(CMD_TIME_REQUEST);
+                cmd.messageID = ii;
+                cmd.counter = static_cast<uint16_t>(jj);
+                queue.push(std::move(cmd));
+            }
+        });
+    }
+    queue.setQueueType(ActionMessageQueue::queue_type::lockfree);
+    int received{0};
+    while (received < producerCount * messageCount) {
+        auto cmd = queue.pop();
+        EXPECT_EQ(cmd.action(), CMD_TIME_REQUEST);
+        ++received;
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    EXPECT_TRUE(queue.empty());
+}
@@ -28,3 +28,37 @@ TEST(broker_tests, global_value_test)
     brk->disconnect();
     EXPECT_FALSE(brk->isConnected());
 }
+
+/** test the memory query of a broker*/
+TEST(broker_tests, memory_query)
+{
+    auto brk = helics::BrokerFactory::create(helics::core_type::TEST, "mbroker", "-f2 --root");
+    auto res = brk->query("broker", "memory");
+    EXPECT_NE(res.find("\"process_string_pool\""), std::string::npos);
+    EXPECT_NE(res.find("\"interned_strings\""), std::string::npos);
+    EXPECT_NE(res.find("\"saved_bytes\""), std::string::npos);
+    brk->disconnect();
+    EXPECT_FALSE(brk->isConnected());
+}
+
+/** test the thread placement query of a broker*/
+TEST(broker_tests, placement_query)
+{
+    auto brk = helics::BrokerFactory::create(helics::core_type::TEST, "pbroker", "-f2 --root");
+    auto res = brk->query("broker", "placement");
+    EXPECT_NE(res.find("\"threads\""), std::string::npos);
+    EXPECT_NE(res.find("\"queue\""), std::string::npos);
+    brk->disconnect();
+    EXPECT_FALSE(brk->isConnected());
+}
+
+TEST(broker_tests, time_updates_query)
+{
+    auto brk = helics::BrokerFactory::create(
+        helics::core_type::TEST, "cbroker", "-f2 --root --coalesce_time_requests");
+    auto res = brk->query("broker", "time_updates");
+    EXPECT_NE(res.find("\"coalescing\":true"), std::string::npos);
+    EXPECT_NE(res.find("\"superseded\""), std::string::npos);
+    brk->disconnect();
+    EXPECT_FALSE(brk->isConnected());
+}
@@ -9,6 +9,8 @@ SPDX-License-Identifier: BSD-3-Clause
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 using namespace helics;
 
 TEST(ftc_tests, dependency_tests)
@@ -221,3 +223,83 @@ TEST(ftc_tests, timing_test1)
     EXPECT_EQ(lastMessage.Tdemin, 0.5);
     EXPECT_TRUE(lastMessage.action() == CMD_TIME_REQUEST);
 }
+
+TEST(ftc_tests, coalesce_updates)
+{
+    ForwardingTimeCoordinator ftc;
+    std::vector<ActionMessage> sent;
+    ftc.setMessageSender([&sent](const ActionMessage& m) { sent.push_back(m); });
+    ftc.coalesceUpdates = true;
+    global_federate_id fed2(2);
+    global_federate_id fed3(3);
+    global_federate_id fed4(4);
+    ftc.addDependency(fed2);
+    ftc.addDependency(fed3);
+    ftc.addDependent(fed4);
+
+    ActionMessage treq(CMD_TIME_REQUEST);
+    auto request = [&](global_federate_id src, Time next) {
+        treq.source_id = src;
+        treq.actionTime = next;
+        treq.Te = next;
+        treq.Tdemin = next;
+        if (ftc.processTimeMessage(treq)) {
+            ftc.updateTimeFactors();
+        }
+    };
+    request(fed2, 1.0);
+    request(fed3, 1.0);
+    request(fed2, 2.0);
+    request(fed3, 2.0);
+    // nothing is sent until the flush
+    EXPECT_TRUE(sent.empty());
+    ftc.flushUpdates();
+    ASSERT_EQ(sent.size(), 1U);
+    EXPECT_EQ(sent[0].action(), CMD_TIME_REQUEST);
+    EXPECT_EQ(sent[0].actionTime, 2.0);
+    EXPECT_TRUE(sent[0].dest_id == fed4);
+    // a second flush has nothing to send
+    ftc.flushUpdates();
+    EXPECT_EQ(sent.size(), 1U);
+
+    // a grant followed by a request returns to the state already sent
+    ActionMessage grant(CMD_TIME_GRANT);
+    grant.source_id = fed2;
+    grant.actionTime = 2.0;
+    if (ftc.processTimeMessage(grant)) {
+        ftc.updateTimeFactors();
+    }
+    request(fed2, 2.0);
+    ftc.flushUpdates();
+    EXPECT_EQ(sent.size(), 1U);
+
+    EXPECT_EQ(
+        ftc.printUpdateCounts(),
+        R"raw({"coalescing":true, "sent":1, "superseded":3, "unchanged":1})raw");
+}
+
+TEST(ftc_tests, no_coalesce_updates)
+{
+    ForwardingTimeCoordinator ftc;
+    std::vector<ActionMessage> sent;
+    ftc.setMessageSender([&sent](const ActionMessage& m) { sent.push_back(m); });
+    global_federate_id fed2(2);
+    global_federate_id fed3(3);
+    ftc.addDependency(fed2);
+    ftc.addDependent(fed3);
+
+    ActionMessage treq(CMD_TIME_REQUEST);
+    treq.source_id = fed2;
+    for (int ii = 1; ii <= 3; ++ii) {
+        treq.actionTime = ii;
+        treq.Te = ii;
+        treq.Tdemin = ii;
+        if (ftc.processTimeMessage(treq)) {
+            ftc.updateTimeFactors();
+        }
+    }
+    // every change is sent immediately when not coalescing
+    EXPECT_EQ(sent.size(), 3U);
+    ftc.flushUpdates();
+    EXPECT_EQ(sent.size(), 3U);
+}
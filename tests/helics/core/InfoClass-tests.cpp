@@ -10,6 +10,10 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/core/NamedInputInfo.hpp"
 
 #include "gtest/gtest.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
 
 TEST(InfoClass_tests, basichandleinfo_test)
 {
@@ -234,6 +238,63 @@ TEST(InfoClass_tests, endpointinfo_test)
     EXPECT_TRUE(endPI.getMessage(maxT) == nullptr);
 }
 
+TEST(InfoClass_tests, endpointinfo_order_test)
+{
+    // compare the queue against a stable sort of the same messages
+    helics::EndpointInfo endPI(
+        {helics::global_federate_id(5), helics::interface_handle(13)}, "name", "type");
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> timeDist(0, 5);
+    std::uniform_int_distribution<int> srcDist(0, 9);
+    std::vector<std::pair<helics::Time, std::string>> expected;
+    for (int ii = 0; ii < 500; ++ii) {
+        auto msg = std::make_unique<helics::Message>();
+        msg->time = helics::Time(timeDist(gen));
+        msg->original_source = "fed" + std::to_string(srcDist(gen));
+        msg->data = std::to_string(ii);
+        expected.emplace_back(msg->time, msg->original_source + ":" + std::to_string(ii));
+        endPI.addMessage(std::move(msg));
+    }
+    std::stable_sort(expected.begin(), expected.end(), [](const auto& e1, const auto& e2) {
+        if (e1.first != e2.first) {
+            return e1.first < e2.first;
+        }
+        return e1.second.substr(0, e1.second.find(':')) < e2.second.substr(0, e2.second.find(':'));
+    });
+    auto countTo = [&expected](helics::Time t) {
+        return static_cast<int32_t>(std::count_if(
+            expected.begin(), expected.end(), [t](const auto& e) { return e.first <= t; }));
+    };
+    EXPECT_EQ(endPI.queueSize(3), countTo(3));
+    EXPECT_EQ(endPI.queueSize(1), countTo(1));
+    EXPECT_EQ(endPI.queueSize(1), countTo(1));
+    EXPECT_EQ(endPI.queueSize(5), 500);
+
+    std::size_t index{0};
+    auto msg = endPI.getMessage(0);
+    while (msg) {
+        EXPECT_EQ(msg->original_source + ":" + msg->data.to_string(), expected[index].second);
+        ++index;
+        msg = endPI.getMessage(0);
+    }
+    EXPECT_EQ(endPI.queueSize(5), 500 - static_cast<int32_t>(index));
+    EXPECT_EQ(endPI.queueSize(2), countTo(2) - static_cast<int32_t>(index));
+
+    auto batch = endPI.getMessages(2);
+    EXPECT_EQ(endPI.queueSize(2), 0);
+    for (auto& bmsg : batch) {
+        EXPECT_EQ(bmsg->original_source + ":" + bmsg->data.to_string(), expected[index].second);
+        ++index;
+    }
+    EXPECT_EQ(static_cast<int32_t>(index), countTo(2));
+    EXPECT_EQ(endPI.firstMessageTime(), helics::Time(3));
+
+    batch = endPI.getMessages(helics::Time::maxVal());
+    EXPECT_EQ(index + batch.size(), expected.size());
+    EXPECT_EQ(endPI.queueSize(helics::Time::maxVal()), 0);
+    EXPECT_EQ(endPI.firstMessageTime(), helics::Time::maxVal());
+}
+
 TEST(InfoClass_tests, filterinfo_test)
 {
     // Mostly testing ordering of message sorting and maxTime function arguments
@@ -0,0 +1,57 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gtest/gtest.h"
+
+/** these test cases test the RouteTable class
+ */
+
+#include "helics/core/RouteTable.hpp"
+
+using namespace helics;
+
+TEST(route_table_tests, federate_routes)
+{
+    RouteTable table;
+    global_federate_id fed1(global_federate_id_shift + 5);
+    global_federate_id fed2(global_federate_id_shift + 1000);
+    EXPECT_EQ(table.getRoute(fed1), parent_route_id);
+    EXPECT_FALSE(table.hasRoute(fed1));
+
+    EXPECT_TRUE(table.addRoute(fed1, route_id(3)));
+    EXPECT_FALSE(table.addRoute(fed1, route_id(4)));
+    EXPECT_EQ(table.getRoute(fed1), route_id(3));
+    EXPECT_EQ(table.getRoute(fed2), parent_route_id);
+
+    table.setRoute(fed1, route_id(4));
+    table.setRoute(fed2, route_id(7));
+    EXPECT_EQ(table.getRoute(fed1), route_id(4));
+    EXPECT_EQ(table.getRoute(fed2), route_id(7));
+
+    table.removeRoute(fed1);
+    EXPECT_FALSE(table.hasRoute(fed1));
+    EXPECT_EQ(table.getRoute(fed1, route_id(9)), route_id(9));
+}
+
+TEST(route_table_tests, broker_and_other_routes)
+{
+    RouteTable table;
+    global_broker_id brk(global_broker_id_shift + 2);
+    global_federate_id fed(global_federate_id_shift + 2);
+    global_federate_id other(25);
+    table.addRoute(brk, route_id(1));
+    table.addRoute(fed, route_id(2));
+    table.addRoute(other, route_id(3));
+    EXPECT_EQ(table.getRoute(brk), route_id(1));
+    EXPECT_EQ(table.getRoute(fed), route_id(2));
+    EXPECT_EQ(table.getRoute(other), route_id(3));
+
+    table.clear();
+    EXPECT_FALSE(table.hasRoute(brk));
+    EXPECT_FALSE(table.hasRoute(fed));
+    EXPECT_FALSE(table.hasRoute(other));
+}
@@ -0,0 +1,114 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "gtest/gtest.h"
+
+/** these test cases test the StringPool interning and the string reference maps
+ */
+
+#include "helics/core/HandleManager.hpp"
+#include "helics/core/StringPool.hpp"
+
+#include <string>
+
+using namespace helics;
+
+TEST(string_pool_tests, intern)
+{
+    std::string str1 = "string_pool_test_name_that_is_long_enough_to_allocate";
+    std::string str2 = str1;
+    auto int1 = StringPool::intern(str1);
+    auto int2 = StringPool::intern(str2);
+    EXPECT_EQ(int1.get(), int2.get());
+    EXPECT_EQ(*int1, str1);
+
+    auto id = StringPool::getId(str1);
+    EXPECT_GE(id, 0);
+    EXPECT_EQ(StringPool::getId(str2), id);
+    EXPECT_EQ(StringPool::getString(id), stx::string_view(str1));
+    EXPECT_TRUE(StringPool::getString(-1).empty());
+
+    auto usage = StringPool::getMemoryUsage();
+    auto int3 = StringPool::intern(str1);
+    auto usage2 = StringPool::getMemoryUsage();
+    EXPECT_EQ(usage2.count, usage.count);
+    EXPECT_GT(usage2.savedBytes, usage.savedBytes);
+}
+
+TEST(string_pool_tests, release)
+{
+    std::string str1 = "string_pool_release_test_name_that_is_long_enough_to_allocate";
+    auto usage = StringPool::getMemoryUsage();
+    auto int1 = StringPool::intern(str1);
+    auto int2 = StringPool::intern(str1);
+    auto id = StringPool::getId(str1);
+    EXPECT_GE(id, 0);
+    EXPECT_EQ(StringPool::getMemoryUsage().count, usage.count + 1);
+
+    int1.reset();
+    EXPECT_EQ(StringPool::getId(str1), id);
+    int2.reset();
+    // the string is removed once the last handle is released
+    EXPECT_EQ(StringPool::getId(str1), -1);
+    EXPECT_TRUE(StringPool::getString(id).empty());
+    EXPECT_EQ(StringPool::getMemoryUsage().count, usage.count);
+
+    auto int3 = StringPool::intern(str1);
+    EXPECT_EQ(*int3, str1);
+    EXPECT_GE(StringPool::getId(str1), 0);
+}
+
+TEST(string_pool_tests, shared_handle_keys)
+{
+    HandleManager hm1;
+    HandleManager hm2;
+    auto& h1 = hm1.addHandle(
+        global_federate_id(global_federate_id_shift),
+        handle_type::endpoint,
+        "pool_endpoint",
+        "type",
+        "units");
+    auto& h2 = hm2.addHandle(
+        global_federate_id(global_federate_id_shift + 1),
+        handle_type::endpoint,
+        "pool_endpoint",
+        "type",
+        "units");
+    EXPECT_EQ(&h1.key, &h2.key);
+    EXPECT_EQ(&h1.type_in, &h2.type);
+    EXPECT_EQ(hm1.getEndpoint(std::string("pool_endpoint")), &h1);
+    EXPECT_EQ(hm2.getEndpoint(std::string("pool_endpoint")), &h2);
+}
+
+TEST(string_pool_tests, ref_map)
+{
+    auto key1 = StringPool::intern("key1");
+    auto key2 = StringPool::intern("key2");
+    string_ref_map<int> map;
+    map.emplace(*key1, 1);
+    map.emplace(*key2, 2);
+    std::string lookup = "key2";
+    auto fnd = map.find(lookup);
+    ASSERT_NE(fnd, map.end());
+    EXPECT_EQ(fnd->second, 2);
+    lookup = "key3";
+    EXPECT_EQ(map.count(lookup), 0U);
+}
+
+TEST(string_pool_tests, handle_map)
+{
+    string_handle_multimap<int> map;
+    map.emplace(StringPool::intern("handle_key1"), 1);
+    map.emplace(StringPool::intern("handle_key1"), 2);
+    EXPECT_GE(StringPool::getId("handle_key1"), 0);
+    std::string lookup = "handle_key1";
+    EXPECT_EQ(map.count(StringPool::lookupKey(lookup)), 2U);
+    map.erase(StringPool::lookupKey(lookup));
+    EXPECT_TRUE(map.empty());
+    // the map keys held the only references
+    EXPECT_EQ(StringPool::getId("handle_key1"), -1);
+}
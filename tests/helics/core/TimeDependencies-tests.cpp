@@ -0,0 +1,171 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/TimeDependencies.hpp"
+#include "helics/core/flagOperations.hpp"
+
+#include "gtest/gtest.h"
+
+#include <random>
+
+using namespace helics;
+
+TEST(time_dependencies_tests, empty)
+{
+    TimeDependencies deps;
+    EXPECT_EQ(deps.getMinNextDependency(), nullptr);
+    EXPECT_EQ(deps.getMinNext(), Time::maxVal());
+    EXPECT_EQ(deps.getMinEvent(), Time::maxVal());
+    EXPECT_EQ(deps.getMinDependentEvent(), Time::maxVal());
+    EXPECT_FALSE(deps.getMinDependentEventFederate().isValid());
+    EXPECT_TRUE(deps.checkIfReadyForTimeGrant(false, 10.0));
+}
+
+TEST(time_dependencies_tests, min_tracking)
+{
+    TimeDependencies deps;
+    for (int ii = 1; ii <= 5; ++ii) {
+        deps.addDependency(global_federate_id(ii));
+    }
+    ActionMessage treq(CMD_TIME_REQUEST);
+    for (int ii = 1; ii <= 5; ++ii) {
+        treq.source_id = global_federate_id(ii);
+        treq.actionTime = ii;
+        treq.Te = ii + 1.0;
+        treq.Tdemin = ii + 0.5;
+        deps.updateTime(treq);
+    }
+    EXPECT_EQ(deps.getMinNext(), 1.0);
+    EXPECT_EQ(deps.getMinEvent(), 2.0);
+    EXPECT_EQ(deps.getMinDependentEvent(), 1.5);
+    EXPECT_TRUE(deps.getMinDependentEventFederate() == global_federate_id(1));
+    EXPECT_FALSE(deps.checkIfReadyForTimeGrant(false, 2.0));
+    EXPECT_TRUE(deps.checkIfReadyForTimeGrant(false, 1.0));
+
+    // move the minimum up, the next dependency becomes the minimum
+    treq.source_id = global_federate_id(1);
+    treq.actionTime = 7.0;
+    treq.Te = 7.0;
+    treq.Tdemin = 7.0;
+    deps.updateTime(treq);
+    EXPECT_EQ(deps.getMinNext(), 2.0);
+    EXPECT_TRUE(deps.getMinNextDependency()->fedID == global_federate_id(2));
+    EXPECT_EQ(deps.getMinDependentEvent(), 2.5);
+
+    // a granted dependency is preferred over a requesting one at the same time
+    ActionMessage grant(CMD_TIME_GRANT);
+    grant.source_id = global_federate_id(3);
+    grant.actionTime = 2.0;
+    deps.updateTime(grant);
+    EXPECT_EQ(
+        deps.getMinNextDependency()->time_state, DependencyInfo::time_state_t::time_granted);
+    EXPECT_FALSE(deps.checkIfReadyForTimeGrant(false, 2.0));
+    // a shared minimum has no single minimum federate
+    EXPECT_EQ(deps.getMinDependentEvent(), 2.0);
+    EXPECT_TRUE(deps.getMinDependentEventFederate() == global_federate_id(3));
+    treq.source_id = global_federate_id(2);
+    treq.actionTime = 2.0;
+    treq.Te = 2.0;
+    treq.Tdemin = 2.0;
+    deps.updateTime(treq);
+    EXPECT_FALSE(deps.getMinDependentEventFederate().isValid());
+
+    deps.removeDependency(global_federate_id(3));
+    deps.removeDependency(global_federate_id(2));
+    EXPECT_EQ(deps.getMinNext(), 4.0);
+    EXPECT_TRUE(deps.getMinDependentEventFederate() == global_federate_id(4));
+}
+
+TEST(time_dependencies_tests, invalid_dependent_events)
+{
+    TimeDependencies deps;
+    deps.addDependency(global_federate_id(1));
+    deps.addDependency(global_federate_id(2));
+    EXPECT_FALSE(deps.hasInvalidDependentEvents());
+    ActionMessage treq(CMD_TIME_REQUEST);
+    treq.source_id = global_federate_id(1);
+    treq.actionTime = 3.0;
+    treq.Te = 3.0;
+    treq.Tdemin = 3.0;
+    deps.updateTime(treq);
+    EXPECT_FALSE(deps.hasInvalidDependentEvents());
+    // a Tdemin below the requested time can't be trusted
+    treq.source_id = global_federate_id(2);
+    treq.Tdemin = 2.0;
+    deps.updateTime(treq);
+    EXPECT_TRUE(deps.hasInvalidDependentEvents());
+    deps.resetDependentEvents(3.0);
+    EXPECT_FALSE(deps.hasInvalidDependentEvents());
+    EXPECT_EQ(deps.getMinEvent(), 3.0);
+}
+
+TEST(time_dependencies_tests, random_updates)
+{
+    TimeDependencies deps;
+    std::mt19937 gen(1234);  // NOLINT
+    std::uniform_int_distribution<int> fedDist(1, 60);
+    std::uniform_int_distribution<int> timeDist(0, 20);
+    std::uniform_int_distribution<int> actionDist(0, 9);
+    for (int ii = 1; ii <= 50; ++ii) {
+        deps.addDependency(global_federate_id(ii));
+    }
+    for (int ii = 0; ii < 5000; ++ii) {
+        auto fed = global_federate_id(fedDist(gen));
+        auto action = actionDist(gen);
+        if (action == 0) {
+            deps.addDependency(fed);
+        } else if (action == 1) {
+            deps.removeDependency(fed);
+        } else if (action < 5) {
+            ActionMessage grant(CMD_TIME_GRANT);
+            grant.source_id = fed;
+            grant.actionTime = timeDist(gen);
+            deps.updateTime(grant);
+        } else if (action < 9) {
+            ActionMessage treq(CMD_TIME_REQUEST);
+            treq.source_id = fed;
+            treq.actionTime = timeDist(gen);
+            treq.Te = treq.actionTime + timeDist(gen) / 4;
+            treq.Tdemin = treq.actionTime + (timeDist(gen) / 8 - 1);
+            deps.updateTime(treq);
+        } else {
+            ActionMessage msg(CMD_SEND_MESSAGE);
+            msg.dest_id = fed;
+            msg.actionTime = timeDist(gen);
+            deps.updateTime(msg);
+        }
+        // compare against a scan of all the dependencies
+        Time minNext = Time::maxVal();
+        Time minEvent = Time::maxVal();
+        Time minDependentEvent = Time::maxVal();
+        bool invalid{false};
+        bool grantedAtMin{false};
+        for (const auto& dep : deps) {
+            if (dep.Tnext < minNext) {
+                minNext = dep.Tnext;
+                grantedAtMin = false;
+            }
+            if (dep.Tnext == minNext &&
+                dep.time_state == DependencyInfo::time_state_t::time_granted) {
+                grantedAtMin = true;
+            }
+            minEvent = std::min(minEvent, dep.Te);
+            minDependentEvent = std::min(minDependentEvent, dep.Tdemin);
+            invalid = invalid || (dep.Tdemin < dep.Tnext);
+        }
+        ASSERT_EQ(deps.getMinNext(), minNext);
+        ASSERT_EQ(deps.getMinEvent(), minEvent);
+        ASSERT_EQ(deps.getMinDependentEvent(), minDependentEvent);
+        ASSERT_EQ(deps.hasInvalidDependentEvents(), invalid);
+        if (deps.size() > 0) {
+            ASSERT_EQ(
+                deps.getMinNextDependency()->time_state ==
+                    DependencyInfo::time_state_t::time_granted,
+                grantedAtMin);
+        }
+    }
+}
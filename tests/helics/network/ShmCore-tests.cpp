@@ -0,0 +1,266 @@
+/*
+Copyright (c) 2017-2020,
+Battelle Memorial Institute; Lawrence Livermore National Security, LLC; Alliance for Sustainable Energy, LLC.  See
+the top-level NOTICE for additional details. All rights reserved.
+SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#include "helics/common/GuardedTypes.hpp"
+#include "helics/core/ActionMessage.hpp"
+#include "helics/core/BrokerFactory.hpp"
+#include "helics/core/Core.hpp"
+#include "helics/core/CoreBroker.hpp"
+#include "helics/core/CoreFactory.hpp"
+#include "helics/core/core-types.hpp"
+#include "helics/network/shm/ShmComms.h"
+#include "helics/network/shm/ShmCore.h"
+#include "helics/network/shm/ShmQueueHelper.h"
+
+#include <future>
+#include <gtest/gtest.h>
+#ifndef _WIN32
+#    include <sys/wait.h>
+#    include <unistd.h>
+#endif
+
+using namespace std::literals::chrono_literals;
+
+TEST(ShmCore, shmcomms_broker)
+{
+    std::string brokerLoc = "brokerSHM";
+    std::string localLoc = "localSHM";
+    helics::shm::ShmComms comm;
+    comm.loadTargetInfo(localLoc, brokerLoc);
+
+    helics::shm::OwnedMailbox mb;
+    bool mbConn = mb.connect(brokerLoc, 65536);
+    ASSERT_TRUE(mbConn);
+
+    comm.setCallback([](const helics::ActionMessage& /*m*/) {});
+
+    bool connected = comm.connect();
+    ASSERT_TRUE(connected);
+    comm.transmit(helics::parent_route_id, helics::CMD_IGNORE);
+
+    auto rM = mb.getMessage(std::chrono::milliseconds(1000));
+    ASSERT_TRUE(rM);
+    EXPECT_TRUE(rM->action() == helics::action_message_def::action_t::cmd_ignore);
+    comm.disconnect();
+}
+
+TEST(ShmCore, shmcomms_rx)
+{
+    std::atomic<int> counter{0};
+    guarded<helics::ActionMessage> act;
+    std::string brokerLoc;
+    std::string localLoc = "localSHM";
+    helics::shm::ShmComms comm;
+    comm.loadTargetInfo(localLoc, brokerLoc);
+
+    comm.setCallback([&counter, &act](const helics::ActionMessage& m) {
+        ++counter;
+        act = m;
+    });
+
+    bool connected = comm.connect();
+    ASSERT_TRUE(connected);
+    helics::shm::MailboxSender mb;
+    ASSERT_TRUE(mb.connect(localLoc, 2));
+
+    helics::ActionMessage cmd(helics::CMD_ACK);
+
+    EXPECT_TRUE(mb.sendMessage(cmd));
+    std::this_thread::sleep_for(250ms);
+    ASSERT_EQ(counter, 1);
+    EXPECT_TRUE(act.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+    comm.disconnect();
+}
+
+TEST(ShmCore, shm_mailbox_wrap)
+{
+    // send enough messages through a small ring to wrap it many times
+    helics::shm::OwnedMailbox mb;
+    ASSERT_TRUE(mb.connect("wrapSHM", 65536));
+    helics::shm::MailboxSender sender;
+    ASSERT_TRUE(sender.connect("wrapSHM", 2));
+
+    constexpr int msgCount{20000};
+    auto res = std::async(std::launch::async, [&sender] {
+        helics::ActionMessage pub(helics::CMD_PUB);
+        pub.payload = "3.14159265358979";
+        for (int ii = 0; ii < msgCount; ++ii) {
+            pub.counter = static_cast<uint16_t>(ii);
+            if (!sender.sendMessage(pub)) {
+                return false;
+            }
+        }
+        return true;
+    });
+    int received{0};
+    int outOfOrder{0};
+    while (received < msgCount) {
+        auto msg = mb.getMessage(std::chrono::milliseconds(1000));
+        if (!msg) {
+            break;
+        }
+        if (msg->counter != static_cast<uint16_t>(received)) {
+            ++outOfOrder;
+        }
+        ++received;
+    }
+    EXPECT_TRUE(res.get());
+    EXPECT_EQ(received, msgCount);
+    EXPECT_EQ(outOfOrder, 0);
+
+    helics::ActionMessage big(helics::CMD_PUB);
+    big.payload.assign(40000, 'a');
+    EXPECT_FALSE(sender.sendMessage(big));
+}
+
+#ifndef _WIN32
+TEST(ShmCore, shm_mailbox_dead_sender)
+{
+    // a sender process that exits without releasing its ring must not hold it forever
+    helics::shm::OwnedMailbox mb;
+    ASSERT_TRUE(mb.connect("deadSHM", 65536));
+    auto child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        helics::shm::MailboxSender sender;
+        bool sent = sender.connect("deadSHM", 2) && sender.sendMessage(helics::CMD_PUB);
+        // skip the destructors so the ring is never released
+        _exit(sent ? 0 : 1);
+    }
+    int status{0};
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+
+    // every ring can be claimed again including the one the child left behind
+    std::vector<helics::shm::MailboxSender> senders(helics::shm::maxMailboxConnections);
+    for (auto& sender : senders) {
+        ASSERT_TRUE(sender.connect("deadSHM", 0)) << sender.getError();
+    }
+    helics::shm::MailboxSender extra;
+    EXPECT_FALSE(extra.connect("deadSHM", 0));
+
+    // the message from the dead sender is still delivered followed by the new ones
+    for (auto& sender : senders) {
+        EXPECT_TRUE(sender.sendMessage(helics::CMD_TICK));
+    }
+    int pubs{0};
+    int ticks{0};
+    while (true) {
+        auto msg = mb.getMessage(std::chrono::milliseconds(100));
+        if (!msg) {
+            break;
+        }
+        if (msg->action() == helics::CMD_PUB) {
+            ++pubs;
+        } else if (msg->action() == helics::CMD_TICK) {
+            ++ticks;
+        }
+    }
+    EXPECT_EQ(pubs, 1);
+    EXPECT_EQ(ticks, static_cast<int>(helics::shm::maxMailboxConnections));
+}
+#endif
+
+TEST(ShmCore, shmComm_transmit_through)
+{
+    std::atomic<int> counter{0};
+    std::string brokerLoc = "brokerSHM";
+    std::string localLoc = "localSHM";
+    std::atomic<int> counter2{0};
+    guarded<helics::ActionMessage> act;
+    guarded<helics::ActionMessage> act2;
+
+    helics::shm::ShmComms comm;
+    comm.loadTargetInfo(localLoc, brokerLoc);
+    helics::shm::ShmComms comm2;
+    comm2.loadTargetInfo(brokerLoc, std::string());
+
+    comm.setCallback([&counter, &act](const helics::ActionMessage& m) {
+        ++counter;
+        act = m;
+    });
+    comm2.setCallback([&counter2, &act2](const helics::ActionMessage& m) {
+        ++counter2;
+        act2 = m;
+    });
+
+    bool connected = comm2.connect();
+    ASSERT_TRUE(connected);
+    connected = comm.connect();
+    ASSERT_TRUE(connected);
+
+    comm.transmit(helics::parent_route_id, helics::CMD_ACK);
+
+    std::this_thread::sleep_for(250ms);
+    ASSERT_EQ(counter2, 1);
+    EXPECT_TRUE(act2.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+
+    comm2.addRoute(helics::route_id(4), localLoc);
+    comm2.transmit(helics::route_id(4), helics::CMD_ACK);
+
+    std::this_thread::sleep_for(250ms);
+    ASSERT_EQ(counter, 1);
+    EXPECT_TRUE(act.lock()->action() == helics::action_message_def::action_t::cmd_ack);
+
+    comm.disconnect();
+    comm2.disconnect();
+}
+
+TEST(ShmCore, shmcore_initialization)
+{
+    std::string initializationString = "--broker_address=testBroker --name=core1";
+    auto core = helics::CoreFactory::create(helics::core_type::SHM, initializationString);
+
+    ASSERT_TRUE(core != nullptr);
+    EXPECT_TRUE(core->isConfigured());
+
+    helics::shm::OwnedMailbox mb;
+    bool mbConn = mb.connect("testBroker", 65536);
+    ASSERT_TRUE(mbConn);
+
+    bool crConn = core->connect();
+    ASSERT_TRUE(crConn);
+
+    auto rM = mb.getMessage(std::chrono::milliseconds(1000));
+    ASSERT_TRUE(rM);
+    EXPECT_EQ(rM->name, "core1");
+    EXPECT_TRUE(rM->action() == helics::action_message_def::action_t::cmd_reg_broker);
+    core->disconnect();
+    core = nullptr;
+    helics::CoreFactory::cleanUpCores(100ms);
+}
+
+/** test case checks default values and makes sure they all mesh together*/
+TEST(ShmCore, shmCore_core_broker_default)
+{
+    std::string initializationString = "-f 1";
+
+    auto broker = helics::BrokerFactory::create(helics::core_type::SHM, initializationString);
+
+    auto core = helics::CoreFactory::create(helics::core_type::SHM, initializationString);
+    bool connected = broker->isConnected();
+    EXPECT_TRUE(connected);
+    connected = core->connect();
+    EXPECT_TRUE(connected);
+
+    core->disconnect();
+    broker->disconnect();
+    core = nullptr;
+    broker = nullptr;
+    helics::CoreFactory::cleanUpCores(100ms);
+    helics::BrokerFactory::cleanUpBrokers(100ms);
+}
+
+TEST(ShmCore, commFactory)
+{
+    auto comm = helics::CommFactory::create("shm");
+    auto comm2 = helics::CommFactory::create(helics::core_type::SHM);
+
+    EXPECT_TRUE(dynamic_cast<helics::shm::ShmComms*>(comm.get()) != nullptr);
+    EXPECT_TRUE(dynamic_cast<helics::shm::ShmComms*>(comm2.get()) != nullptr);
+}
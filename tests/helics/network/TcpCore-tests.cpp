@@ -328,6 +328,69 @@ TEST(TcpCore, tcpComm_transmit_through)
     std::this_thread::sleep_for(100ms);
 }
 
+TEST(TcpCore, tcpComm_transmit_batch)
+{
+    // many queued messages are combined into batched writes and must arrive complete and in order
+    std::this_thread::sleep_for(300ms);
+    std::atomic<int> counter2{0};
+    std::atomic<int> outOfOrder{0};
+
+    std::string host = "localhost";
+    helics::tcp::TcpComms comm;
+    comm.loadTargetInfo(host, host);
+    comm.setFlag("reuse_address", true);
+    helics::tcp::TcpComms comm2;
+    comm2.loadTargetInfo(host, std::string());
+
+    comm.setBrokerPort(DEFAULT_TCP_BROKER_PORT_NUMBER + 3);
+    comm.setName("tests");
+    comm2.setName("test2");
+    comm2.setPortNumber(DEFAULT_TCP_BROKER_PORT_NUMBER + 3);
+    comm2.setFlag("reuse_address", true);
+    comm.setPortNumber(TCP_SECONDARY_PORT);
+
+    comm.setCallback([](const helics::ActionMessage& /*m*/) {});
+    comm2.setCallback([&counter2, &outOfOrder](const helics::ActionMessage& m) {
+        if (m.action() == helics::CMD_PUB) {
+            if (m.counter != counter2) {
+                ++outOfOrder;
+            }
+            ++counter2;
+        }
+    });
+
+    bool connected1 = comm2.connect();
+    ASSERT_TRUE(connected1);
+    bool connected2 = comm.connect();
+    if (!connected2) { // lets just try again if it is not connected
+        connected2 = comm.connect();
+    }
+    ASSERT_TRUE(connected2);
+
+    constexpr int messageCount{2000};
+    helics::ActionMessage pub(helics::CMD_PUB);
+    pub.payload = std::string(100, 'a');
+    for (int ii = 0; ii < messageCount; ++ii) {
+        pub.counter = static_cast<uint16_t>(ii);
+        comm.transmit(helics::parent_route_id, pub);
+    }
+    int waits{0};
+    while (counter2 < messageCount && waits < 20) {
+        std::this_thread::sleep_for(100ms);
+        ++waits;
+    }
+    EXPECT_EQ(counter2, messageCount);
+    EXPECT_EQ(outOfOrder, 0);
+
+    comm.disconnect();
+    EXPECT_TRUE(!comm.isConnected());
+
+    comm2.disconnect();
+    EXPECT_TRUE(!comm2.isConnected());
+
+    std::this_thread::sleep_for(100ms);
+}
+
 TEST(TcpCore, tcpComm_transmit_add_route)
 {
     std::this_thread::sleep_for(300ms);
@@ -13,6 +13,9 @@ SPDX-License-Identifier: BSD-3-Clause
 #include "helics/network/test/TestCore.h"
 
 #include "gtest/gtest.h"
+#include <chrono>
+#include <string>
+#include <thread>
 
 using helics::Core;
 using namespace helics::CoreFactory;
@@ -112,6 +115,39 @@ TEST(TestCore_tests, testcore_pubsub_value_test)
     helics::CoreFactory::cleanUpCores();
 }
 
+TEST(TestCore_tests, testcore_held_registrations_idle)
+{
+    // registrations held for packing must reach the broker even if the core then sits idle
+    auto broker = helics::BrokerFactory::create(helics::core_type::TEST, std::string{});
+    ASSERT_TRUE(broker);
+    std::string configureString = "--broker=" + broker->getIdentifier();
+    auto core = create(helics::core_type::TEST, configureString);
+    ASSERT_TRUE(core);
+    core->connect();
+    ASSERT_TRUE(core->isConnected());
+    auto id = core->registerFederate("sim1", helics::CoreFederateInfo());
+    core->registerPublication(id, "idle_pub1", "double", "");
+    core->registerPublication(id, "idle_pub2", "double", "");
+
+    // nothing more is sent to the core so only the drained queue can release the registrations
+    std::string pubs;
+    for (int ii = 0; ii < 100; ++ii) {
+        pubs = broker->query("broker", "publications");
+        if (pubs == "[idle_pub1;idle_pub2]") {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    EXPECT_EQ(pubs, "[idle_pub1;idle_pub2]");
+    core->finalize(id);
+    core->disconnect();
+    broker->disconnect();
+    core = nullptr;
+    broker = nullptr;
+    helics::CoreFactory::cleanUpCores();
+    helics::BrokerFactory::cleanUpBrokers();
+}
+
 TEST(TestCore_tests, testcore_send_receive_test)
 {
     const char* initializationString =
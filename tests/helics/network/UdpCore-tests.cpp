@@ -194,6 +194,59 @@ TEST(UdpCore, udpComm_transmit_through)
     std::this_thread::sleep_for(100ms);
 }
 
+TEST(UdpCore, udpComm_transmit_batch)
+{
+    // queued messages are packed into shared datagrams and must all be delivered
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    std::atomic<int> counter2{0};
+
+    std::string host = "localhost";
+    helics::udp::UdpComms comm;
+    comm.loadTargetInfo(host, host);
+    helics::udp::UdpComms comm2;
+    comm2.loadTargetInfo(host, "");
+
+    comm.setBrokerPort(UDP_BROKER_PORT);
+    comm.setName("tests");
+    comm2.setName("test2");
+    comm2.setPortNumber(UDP_BROKER_PORT);
+    comm.setPortNumber(UDP_SECONDARY_PORT);
+    comm.setFlag("batching", true);
+    comm2.setFlag("batching", true);
+
+    comm.setCallback([](const helics::ActionMessage& /*m*/) {});
+    comm2.setCallback([&counter2](const helics::ActionMessage& m) {
+        if (m.action() == helics::CMD_PUB) {
+            ++counter2;
+        }
+    });
+
+    auto connected_fut = std::async(std::launch::async, [&comm] { return comm.connect(); });
+
+    bool connected = comm2.connect();
+    ASSERT_TRUE(connected);
+    connected = connected_fut.get();
+    ASSERT_TRUE(connected);
+
+    constexpr int messageCount{500};
+    helics::ActionMessage pub(helics::CMD_PUB);
+    pub.payload = std::string(100, 'a');
+    for (int ii = 0; ii < messageCount; ++ii) {
+        pub.counter = static_cast<uint16_t>(ii);
+        comm.transmit(helics::parent_route_id, pub);
+    }
+    int waits{0};
+    while (counter2 < messageCount && waits < 20) {
+        std::this_thread::sleep_for(100ms);
+        ++waits;
+    }
+    EXPECT_EQ(counter2, messageCount);
+
+    comm.disconnect();
+    comm2.disconnect();
+    std::this_thread::sleep_for(100ms);
+}
+
 TEST(UdpCore, udpComm_transmit_add_route)
 {
     std::this_thread::sleep_for(std::chrono::milliseconds(500));
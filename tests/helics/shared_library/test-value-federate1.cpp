@@ -1022,6 +1022,71 @@ TEST_P(vfed_simple_type_tests, test_info_field)
     EXPECT_EQ(wait, helics_true);
 }
 
+TEST_P(vfed_type_tests, publish_batch)
+{
+    SetupTest(helicsCreateValueFederate, GetParam(), 1, 1.0);
+    auto vFed = GetFederateAt(0);
+
+    helics_publication pubs[3];
+    pubs[0] =
+        helicsFederateRegisterGlobalPublication(vFed, "pub1", helics_data_type_double, "", &err);
+    pubs[1] = helicsFederateRegisterGlobalPublication(vFed, "pub2", helics_data_type_int, "", &err);
+    pubs[2] =
+        helicsFederateRegisterGlobalPublication(vFed, "pub3", helics_data_type_string, "", &err);
+    auto sub1 = helicsFederateRegisterSubscription(vFed, "pub1", nullptr, &err);
+    auto sub2 = helicsFederateRegisterSubscription(vFed, "pub2", nullptr, &err);
+    auto sub3 = helicsFederateRegisterSubscription(vFed, "pub3", nullptr, &err);
+    CE(helicsFederateEnterExecutingMode(vFed, &err));
+
+    double vals[3] = {1.25, 7.0, 3.5};
+    CE(helicsFederatePublishBatchDouble(vFed, pubs, vals, 3, &err));
+    CE(helicsFederateRequestTime(vFed, 1.0, &err));
+    EXPECT_DOUBLE_EQ(helicsInputGetDouble(sub1, &err), 1.25);
+    EXPECT_EQ(helicsInputGetInteger(sub2, &err), 7);
+    EXPECT_DOUBLE_EQ(helicsInputGetDouble(sub3, &err), 3.5);
+
+    helicsFederatePublishBatchDouble(vFed, pubs, nullptr, 3, &err);
+    EXPECT_EQ(err.error_code, helics_error_invalid_argument);
+    helicsErrorClear(&err);
+    CE(helicsFederateFinalize(vFed, &err));
+}
+
+TEST_P(vfed_type_tests, get_batch)
+{
+    SetupTest(helicsCreateValueFederate, GetParam(), 1, 1.0);
+    auto vFed = GetFederateAt(0);
+
+    auto pub1 =
+        helicsFederateRegisterGlobalPublication(vFed, "pub1", helics_data_type_double, "", &err);
+    auto pub2 = helicsFederateRegisterGlobalPublication(vFed, "pub2", helics_data_type_int, "", &err);
+    helics_input subs[2];
+    subs[0] = helicsFederateRegisterSubscription(vFed, "pub1", nullptr, &err);
+    subs[1] = helicsFederateRegisterSubscription(vFed, "pub2", nullptr, &err);
+    CE(helicsFederateEnterExecutingMode(vFed, &err));
+
+    CE(helicsPublicationPublishDouble(pub1, 1.25, &err));
+    CE(helicsPublicationPublishInteger(pub2, 7, &err));
+    CE(helicsFederateRequestTime(vFed, 1.0, &err));
+    double vals[2] = {0.0, 0.0};
+    uint64_t updated{0};
+    CE(helicsFederateGetBatchDouble(vFed, subs, vals, &updated, 2, &err));
+    EXPECT_DOUBLE_EQ(vals[0], 1.25);
+    EXPECT_DOUBLE_EQ(vals[1], 7.0);
+    EXPECT_EQ(updated, 3U);
+
+    CE(helicsPublicationPublishInteger(pub2, 9, &err));
+    CE(helicsFederateRequestTime(vFed, 2.0, &err));
+    CE(helicsFederateGetBatchDouble(vFed, subs, vals, &updated, 2, &err));
+    EXPECT_DOUBLE_EQ(vals[0], 1.25);
+    EXPECT_DOUBLE_EQ(vals[1], 9.0);
+    EXPECT_EQ(updated, 2U);
+
+    helicsFederateGetBatchDouble(vFed, subs, nullptr, nullptr, 2, &err);
+    EXPECT_EQ(err.error_code, helics_error_invalid_argument);
+    helicsErrorClear(&err);
+    CE(helicsFederateFinalize(vFed, &err));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     vfed_tests,
     vfed_simple_type_tests,
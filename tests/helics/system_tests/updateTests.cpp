@@ -90,7 +90,7 @@ TEST_F(update_tests, test_single_update_string)
     std::string val;
     sub.getValue(val);
 
-    EXPECT_EQ(val, "3.100000");
+    EXPECT_EQ(val, "3.1");
 
     auto f1time = std::async(std::launch::async, [&]() { return fedA->requestTime(1.0); });
     auto gtime = fedB->requestTime(1.0);
@@ -102,7 +102,7 @@ TEST_F(update_tests, test_single_update_string)
     sub.getValue(val);
     EXPECT_TRUE(!sub.isUpdated());
     // make sure the string is what we expect
-    EXPECT_EQ(val, "4.790000");
+    EXPECT_EQ(val, "4.79");
     sub.getValue(val);
     EXPECT_TRUE(!sub.isUpdated());
     pub.publish(testValue2);
@@ -115,7 +115,7 @@ TEST_F(update_tests, test_single_update_string)
     sub.getValue(val);
     EXPECT_TRUE(!sub.isUpdated());
     // make sure the string is what we expect
-    EXPECT_EQ(val, "9.340000");
+    EXPECT_EQ(val, "9.34");
     sub.getValue(val);
     EXPECT_TRUE(!sub.isUpdated());
     double v2{0};
@@ -155,7 +155,7 @@ TEST_F(update_tests, test_single_update_vector)
     std::string val;
     sub.getValue(val);
 
-    EXPECT_EQ(val, "3.100000");
+    EXPECT_EQ(val, "3.1");
 
     auto f1time = std::async(std::launch::async, [&]() { return fedA->requestTime(1.0); });
     auto gtime = fedB->requestTime(1.0);
@@ -167,7 +167,7 @@ TEST_F(update_tests, test_single_update_vector)
     sub.getValue(val);
     EXPECT_TRUE(!sub.isUpdated());
     // make sure the string is what we expect
-    EXPECT_EQ(val, "v1[4.790000]");
+    EXPECT_EQ(val, "v1[4.79]");
     sub.getValue(val);
     EXPECT_TRUE(!sub.isUpdated());
     pub.publish(testValue2);
@@ -180,7 +180,7 @@ TEST_F(update_tests, test_single_update_vector)
     sub.getValue(val);
     EXPECT_TRUE(!sub.isUpdated());
     // make sure the string is what we expect
-    EXPECT_EQ(val, "v1[9.340000]");
+    EXPECT_EQ(val, "v1[9.34]");
     sub.getValue(val);
     EXPECT_TRUE(!sub.isUpdated());
     double v2{0};
@@ -220,7 +220,7 @@ TEST_F(update_tests, test_single_update_vector_char_ptr)
     std::array<char, 50> val;
     sub.getValue(val.data(), 50);
 
-    EXPECT_EQ(std::string(val.data()), "3.100000");
+    EXPECT_EQ(std::string(val.data()), "3.1");
 
     auto f1time = std::async(std::launch::async, [&]() { return fedA->requestTime(1.0); });
     auto gtime = fedB->requestTime(1.0);
@@ -232,7 +232,7 @@ TEST_F(update_tests, test_single_update_vector_char_ptr)
     sub.getValue(val.data(), 50);
     EXPECT_TRUE(!sub.isUpdated());
     // make sure the string is what we expect
-    EXPECT_EQ(std::string(val.data()), "v1[4.790000]");
+    EXPECT_EQ(std::string(val.data()), "v1[4.79]");
     sub.getValue(val.data(), 50);
     EXPECT_TRUE(!sub.isUpdated());
     pub.publish(testValue2);
@@ -245,7 +245,7 @@ TEST_F(update_tests, test_single_update_vector_char_ptr)
     sub.getValue(val.data(), 50);
     EXPECT_TRUE(!sub.isUpdated());
     // make sure the string is what we expect
-    EXPECT_EQ(std::string(val.data()), "v1[9.340000]");
+    EXPECT_EQ(std::string(val.data()), "v1[9.34]");
     sub.getValue(val.data(), 50);
     EXPECT_TRUE(!sub.isUpdated());
     double v2{0};